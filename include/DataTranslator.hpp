@@ -39,15 +39,234 @@
 # error This file requires compiler and library support for the ISO C++11 standard.
 #endif
 
+#include "HashedKey.hpp"
+#include "MonotonicArena.hpp"
+#include "StringView.hpp"
 #include "detail/concepts.hpp"
+#include "detail/key.inl"
+#include "detail/scheme.inl"
+#include "detail/algorithms.inl"
+#include "detail/enum_table.inl"
+#include "detail/perfect_hash.inl"
 
-#include <map>
+#include <algorithm>
 #include <string>
 #include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace serial {
 
+  ////////////////////////////////////////////////////////////////////////////
+  /// \enum serial::member_kind
+  ///
+  /// \brief The kind of member that is translated, which determines the
+  ///        translation scheme function used to retrieve it
+  ///
+  /// The order of the enumerators is the order in which a frozen
+  /// \c DataTranslator translates its members.
+  ////////////////////////////////////////////////////////////////////////////
+  enum class member_kind : unsigned char
+  {
+    bool_scalar,
+    int_scalar,
+    float_scalar,
+    string_scalar,
+    string_view_scalar,
+    converted_scalar,
+    enum_scalar,
+    bool_vector,
+    int_vector,
+    float_vector,
+    string_vector,
+    string_view_vector,
+    struct_vector,
+    converted_vector,
+  };
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \enum serial::translate_mode
+  ///
+  /// \brief Determines how translation treats the existing contents of
+  ///        vector members
+  ////////////////////////////////////////////////////////////////////////////
+  enum class translate_mode : unsigned char
+  {
+    append,  ///< Translated elements are appended to the existing elements
+    replace, ///< Existing elements are overwritten in place, keeping the
+             ///< capacity of the vector and of its elements
+  };
+
+  namespace detail {
+
+    template<typename KeyStringT, typename StringT>
+    struct element_plan;
+
+    struct member_converter;
+
+    /// \brief A single entry in a translation plan
+    template<typename KeyStringT, typename StringT>
+    struct plan_entry
+    {
+      KeyStringT    key;        ///< The key to request from the scheme
+      std::uint64_t hash;       ///< The hash of the key
+      std::size_t   offset;     ///< The byte offset of the member in the object
+      member_kind   kind;       ///< The kind of member to translate
+      std::size_t   key_offset; ///< The offset of the key in the key table, once frozen
+
+      /// The plan of the elements of a structure vector member
+      std::shared_ptr<const element_plan<KeyStringT,StringT>> elements;
+
+      /// The converter of a converted member
+      std::shared_ptr<const member_converter> converter;
+
+      /// The names of the values of an enum member
+      std::shared_ptr<const enum_table<StringT>> enums;
+    };
+
+    /// \brief The plan of the elements of a structure vector member
+    ///
+    /// The vector is only accessed through the functions of the plan, which
+    /// are instantiated for its type when the member is added, so that the
+    /// plan itself does not depend on the element type.
+    template<typename KeyStringT, typename StringT>
+    struct element_plan
+    {
+      std::vector<plan_entry<KeyStringT,StringT>> members; ///< The plan of each element
+      std::size_t stride;                         ///< The size of each element
+
+      void        (*resize)( void* vector, std::size_t size ); ///< Resizes the vector
+      void*       (*data)( void* vector );                     ///< Gets the first element
+      std::size_t (*size)( const void* vector );               ///< Gets the number of elements
+    };
+
+    template<typename Vector>
+    inline void resize_elements( void* vector, std::size_t size )
+    {
+      static_cast<Vector*>(vector)->resize(size);
+    }
+
+    template<typename Vector>
+    inline void* element_data( void* vector )
+    {
+      return static_cast<Vector*>(vector)->data();
+    }
+
+    template<typename Vector>
+    inline std::size_t element_count( const void* vector )
+    {
+      return static_cast<const Vector*>(vector)->size();
+    }
+
+    template<typename Vector>
+    inline void reserve_elements( void* vector, std::size_t size )
+    {
+      static_cast<Vector*>(vector)->reserve(size);
+    }
+
+    template<typename Vector>
+    inline void truncate_elements( void* vector, std::size_t size )
+    {
+      auto& out = *static_cast<Vector*>(vector);
+      out.erase( out.begin() + static_cast<std::ptrdiff_t>(size), out.end() );
+    }
+
+    //------------------------------------------------------------------------
+
+    /// \brief Converts the values read for a member into the type of the
+    ///        member
+    ///
+    /// As with the element plan, the converter is only invoked through
+    /// functions instantiated for its type when the member is added, and the
+    /// call to the converter is inlined into them.
+    struct member_converter
+    {
+      member_kind source; ///< The kind of value read from the scheme
+
+      /// Converts \p value into the scalar \p member
+      void (*assign)( const member_converter& self, const void* value, void* member );
+
+      /// Converts \p value into the element at \p index of \p vector,
+      /// appending it when \p index is the size of \p vector
+      void (*write)( const member_converter& self, const void* value, void* vector, std::size_t index );
+
+      void        (*reset)( void* member );                       ///< Resets the member
+      void        (*reserve)( void* vector, std::size_t size );   ///< Reserves elements
+      void        (*truncate)( void* vector, std::size_t size );  ///< Removes the elements from \p size
+      std::size_t (*size)( const void* vector );                  ///< Gets the number of elements
+    };
+
+    /// \brief A member converter holding a \p Converter
+    template<typename Converter>
+    struct converter_holder : member_converter
+    {
+      converter_holder( const member_converter& functions, Converter function )
+        : member_converter(functions),
+          converter(std::move(function))
+      {
+
+      }
+
+      Converter converter; ///< The converter to invoke
+    };
+
+    template<typename Converter, typename Source, typename Member>
+    inline void assign_converted( const member_converter& self, const void* value, void* member )
+    {
+      const auto& converter = static_cast<const converter_holder<Converter>&>(self).converter;
+      *static_cast<Member*>(member) = converter(*static_cast<const Source*>(value));
+    }
+
+    template<typename Converter, typename Source, typename Vector>
+    inline void write_converted( const member_converter& self, const void* value, void* vector, std::size_t index )
+    {
+      const auto& converter = static_cast<const converter_holder<Converter>&>(self).converter;
+      auto& out = *static_cast<Vector*>(vector);
+
+      if(index < out.size())
+      {
+        out[index] = converter(*static_cast<const Source*>(value));
+      }
+      else
+      {
+        out.push_back(converter(*static_cast<const Source*>(value)));
+      }
+    }
+
+    template<typename Member>
+    inline void reset_converted( void* member )
+    {
+      reset_member( *static_cast<Member*>(member) );
+    }
+
+    /// \brief Deduces the type of the value that a converter takes from the
+    ///        parameter of its function call operator, or of the function
+    template<typename Converter, typename = void>
+    struct converter_traits;
+
+    template<typename R, typename A>
+    struct converter_traits<R(*)(A)>
+    {
+      typedef typename std::decay<A>::type argument_type;
+    };
+
+    template<typename C, typename R, typename A>
+    struct converter_traits<R(C::*)(A) const>
+    {
+      typedef typename std::decay<A>::type argument_type;
+    };
+
+    template<typename Converter>
+    struct converter_traits<Converter,concepts::void_t<decltype(&Converter::operator())>>
+      : converter_traits<decltype(&Converter::operator())>{};
+
+    template<typename Converter>
+    using converter_argument_t = typename converter_traits<Converter>::argument_type;
+
+  } // namespace detail
+
   ////////////////////////////////////////////////////////////////////////////
   /// \class serial::DataTranslator
   ///
@@ -76,19 +295,33 @@ namespace serial {
   /// The type of string used for keys is optionally configurable with
   /// the KeyS argument. This is necessary for supporting UTF strings
   ///
+  /// Copies of a translator share its translation plan, so translators can
+  /// be copied cheaply into worker threads or registries. Any number of
+  /// threads may call the const member functions of translators sharing a
+  /// plan at the same time, including #translate; only the functions that
+  /// modify a translator, such as #add_member, #freeze and #prepare, need
+  /// exclusive access to that one translator.
+  ///
+  /// The allocator of vector members is configurable with the AllocatorT
+  /// argument, such as \c serial::arena_allocator to translate objects
+  /// whose memory comes from a \c serial::monotonic_arena. An allocator-aware
+  /// \p StringT can be given in the same way.
+  ///
   /// \tparam T          The type to translate into
   /// \tparam BoolT      the type to use for boolean values
   /// \tparam IntT       The type to use for integral values
   /// \tparam FloatT     The type to use for floating point values
   /// \tparam StringT    The type to use for string values
   /// \tparam KeyStringT The type to use for key strings
+  /// \tparam AllocatorT The allocator template to use for vector members
   ////////////////////////////////////////////////////////////////////////////
   template<typename T,
            typename BoolT   = bool,
            typename IntT    = int,
            typename FloatT  = float,
            typename StringT = std::string,
-           typename KeyStringT = std::string>
+           typename KeyStringT = std::string,
+           template<typename> class AllocatorT = std::allocator>
   class DataTranslator final
   {
     //------------------------------------------------------------------------
@@ -96,7 +329,7 @@ namespace serial {
     //------------------------------------------------------------------------
   public:
 
-    typedef DataTranslator<T,BoolT,IntT,FloatT,StringT,KeyStringT> this_type;
+    typedef DataTranslator<T,BoolT,IntT,FloatT,StringT,KeyStringT,AllocatorT> this_type;
 
     typedef T           value_type;      ///< Type of this Data Translator
     typedef T*          pointer;         ///< Type representing pointer
@@ -112,17 +345,32 @@ namespace serial {
     typedef StringT    string_type;     ///< The type to use for string literals.
     typedef KeyStringT key_string_type; ///< The type to use for the key strings
 
+    /// The type of key, carrying its hash, passed to schemes that accept it
+    typedef basic_hashed_key<typename KeyStringT::value_type> hashed_key_type;
+
+    /// The type of strings borrowed from the translated document
+    typedef basic_string_view<typename StringT::value_type> string_view_type;
+
+    // Vector Types
+    typedef std::vector<bool_type,AllocatorT<bool_type>>     bool_vector_type;   ///< The type of boolean vectors
+    typedef std::vector<int_type,AllocatorT<int_type>>       int_vector_type;    ///< The type of integer vectors
+    typedef std::vector<float_type,AllocatorT<float_type>>   float_vector_type;  ///< The type of float vectors
+    typedef std::vector<string_type,AllocatorT<string_type>> string_vector_type; ///< The type of string vectors
+    typedef std::vector<string_view_type,AllocatorT<string_view_type>> string_view_vector_type; ///< The type of borrowed string vectors
+
     // Member pointers to scalar types
     typedef bool_type   value_type::*bool_member;  ///< Class pointer to bool member
     typedef int_type    value_type::*int_member;   ///< Class pointer to long member
     typedef float_type  value_type::*float_member; ///< Class pointer to float member
     typedef string_type value_type::*string_member;///< Class pointer to string member
+    typedef string_view_type value_type::*string_view_member; ///< Class pointer to borrowed string member
 
     // Member pointers to vector types
-    typedef std::vector<bool_type>   value_type::*bool_vector_member;  ///< Class pointer to bool vector member
-    typedef std::vector<int_type>    value_type::*int_vector_member;   ///< Class pointer to long vector member
-    typedef std::vector<float_type>  value_type::*float_vector_member; ///< Class pointer to float vector member
-    typedef std::vector<string_type> value_type::*string_vector_member;///< Class pointer to string vector member
+    typedef bool_vector_type   value_type::*bool_vector_member;  ///< Class pointer to bool vector member
+    typedef int_vector_type    value_type::*int_vector_member;   ///< Class pointer to long vector member
+    typedef float_vector_type  value_type::*float_vector_member; ///< Class pointer to float vector member
+    typedef string_vector_type value_type::*string_vector_member;///< Class pointer to string vector member
+    typedef string_view_vector_type value_type::*string_view_vector_member; ///< Class pointer to borrowed string vector member
 
     //-------------------------------------------------------------------------
     // Constructor
@@ -132,6 +380,20 @@ namespace serial {
     /// \brief Initializes the Data Translator with the specified binary data
     DataTranslator( ) = default;
 
+    /// \brief Copies a Data Translator
+    ///
+    /// The copy shares the translation plan of \p other, so copying is a
+    /// reference count increment regardless of the number of members. The
+    /// plan is only cloned if either translator later adds members or is
+    /// frozen. Moving a translator copies it in the same way, so that the
+    /// moved-from translator remains usable.
+    ///
+    /// \param other the translator to copy
+    DataTranslator( const DataTranslator& other ) = default;
+
+    /// \copydoc DataTranslator(const DataTranslator&)
+    DataTranslator& operator=( const DataTranslator& other ) = default;
+
     //-------------------------------------------------------------------------
     // Capacity
     //-------------------------------------------------------------------------
@@ -143,6 +405,58 @@ namespace serial {
     /// \return the total number of members to translate
     size_type members() const noexcept;
 
+    /// \brief Checks whether this \c DataTranslator has been frozen into
+    ///        its final translation plan
+    ///
+    /// \return \c true if #freeze has been called since the last member
+    ///         was added
+    bool frozen() const noexcept;
+
+    //-------------------------------------------------------------------------
+    // Plan Compilation
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Freezes the registered members into an immutable translation
+    ///        plan
+    ///
+    /// The plan is a single contiguous array of {key, offset, kind} records
+    /// ordered by member kind, so that #translate walks every member in one
+    /// linear pass with a predictable dispatch.
+    ///
+    /// Freezing also interns every distinct key into a single contiguous
+    /// table, each key padded to a 16 byte block, and generates a minimal
+    /// perfect hash over the keys, which resolves a key to its members with
+    /// a single comparison against the table for #translate_pull and
+    /// #has_member. Hashed keys passed to schemes point into the table.
+    ///
+    /// Dotted keys are also split into their segments and grouped into a
+    /// prefix trie, so that schemes that provide \c child(segment) resolve
+    /// every shared prefix once per #translate.
+    ///
+    /// Adding members after freezing is permitted, but discards the frozen
+    /// state until #freeze is called again.
+    ///
+    /// \return reference to (*this) to allow chaining calls
+    this_type& freeze();
+
+    /// \brief Prepares the key of every member for translation with schemes
+    ///        of type \p PreparingTranslationScheme
+    ///
+    /// The scheme's \c prepare(key) is called once for each member, and the
+    /// handles it returns are passed to the scheme in place of the keys on
+    /// every later call to #translate or #translate_batch with a scheme of
+    /// the same type. The handles must therefore only depend on the key, and
+    /// not on the data of \p data.
+    ///
+    /// Prepared handles are discarded when members are added or the
+    /// translator is frozen, so this should be called last.
+    ///
+    /// \param data a scheme used to prepare the keys
+    /// \return reference to (*this) to allow chaining calls
+    template<typename PreparingTranslationScheme>
+    this_type& prepare( const PreparingTranslationScheme& data );
+
     //-------------------------------------------------------------------------
     // Verbose Member Loaders
     //-------------------------------------------------------------------------
@@ -186,6 +500,20 @@ namespace serial {
     this_type& add_string_member( const key_string_type& name,
                                   string_member member );
 
+    /// \brief Adds a borrowed string pointer-to-member
+    ///
+    /// The member views the string in the document backing the translation
+    /// scheme instead of copying it, and is only valid for as long as that
+    /// document is alive. It is only translated by schemes that provide
+    /// 'as_string_view'.
+    ///
+    /// \param name the name of the configuration
+    /// \param member the string view pointer-to-member to translate
+    ///
+    /// \return reference to (*this) to allow chaining calls
+    this_type& add_string_view_member( const key_string_type& name,
+                                       string_view_member member );
+
     // Vector types
 
     /// \brief Adds a boolean vector pointer-to-member
@@ -224,6 +552,123 @@ namespace serial {
     this_type& add_string_vector_member( const key_string_type& name,
                                          string_vector_member member );
 
+    /// \brief Adds a borrowed string vector pointer-to-member
+    ///
+    /// Each element views a string in the document backing the translation
+    /// scheme, as with #add_string_view_member. It is only translated by
+    /// schemes that provide 'as_string_view_sequence'.
+    ///
+    /// \param name the name of the configuration
+    /// \param member the string view vector pointer-to-member to translate
+    ///
+    /// \return reference to (*this) to allow chaining calls
+    this_type& add_string_view_vector_member( const key_string_type& name,
+                                              string_view_vector_member member );
+
+    // Structure types
+
+    /// \brief Adds a nested structure pointer-to-member, translated with the
+    ///        members of \p translator
+    ///
+    /// Every member of \p translator is added to this translator, keyed by
+    /// \p name and a '.' before its own key, at its offset within
+    /// \p member. Nested members are therefore part of this translator's
+    /// flat plan, and a frozen translator resolves the shared key prefix
+    /// once and fills the whole object in a single pass. \p translator may
+    /// itself have nested members.
+    ///
+    /// The members of \p translator are copied when this is called; members
+    /// that are later added to \p translator are not translated.
+    ///
+    /// \param name the name of the configuration
+    /// \param member the structure pointer-to-member to translate
+    /// \param translator the translator of the structure's members
+    ///
+    /// \return reference to (*this) to allow chaining calls
+    template<typename U>
+    this_type& add_struct_member( const key_string_type& name,
+                                  U value_type::*member,
+                                  const DataTranslator<U,BoolT,IntT,FloatT,StringT,KeyStringT,AllocatorT>& translator );
+
+    /// \brief Adds a structure vector pointer-to-member, whose elements are
+    ///        translated with the members of \p translator
+    ///
+    /// The member is translated from the sequence returned by the scheme's
+    /// 'as_sequence(name)', which is a RandomAccessSequenceTranslationScheme.
+    /// The vector is resized once to fit the whole sequence, constructing
+    /// the elements in place, and the elements are then translated a member
+    /// at a time across the whole sequence. Schemes that do not provide
+    /// 'as_sequence' leave the member untouched.
+    ///
+    /// The members of \p translator are copied when this is called.
+    ///
+    /// \param name the name of the configuration
+    /// \param member the structure vector pointer-to-member to translate
+    /// \param translator the translator of each element
+    ///
+    /// \return reference to (*this) to allow chaining calls
+    template<typename U>
+    this_type& add_struct_vector_member( const key_string_type& name,
+                                         std::vector<U,AllocatorT<U>> value_type::*member,
+                                         const DataTranslator<U,BoolT,IntT,FloatT,StringT,KeyStringT,AllocatorT>& translator );
+
+    /// \brief Adds a pointer-to-member of any type, translated from the
+    ///        value returned by \p converter
+    ///
+    /// \p converter is a function, or a function object with a single const
+    /// function call operator, that takes one of the bool, int, float,
+    /// string or string view types of this translator, and returns a value
+    /// assignable to the member. The argument type selects the scheme
+    /// function that is read, and each value is passed directly from the
+    /// scheme to the converter.
+    ///
+    /// \param name the name of the configuration
+    /// \param member the pointer-to-member to translate
+    /// \param converter the converter of the value read from the scheme
+    ///
+    /// \return reference to (*this) to allow chaining calls
+    template<typename U, typename Converter>
+    this_type& add_converted_member( const key_string_type& name,
+                                     U value_type::*member,
+                                     Converter converter );
+
+    /// \brief Adds a vector pointer-to-member of any element type, with each
+    ///        element translated from the value returned by \p converter
+    ///
+    /// \p converter is invoked once for each value of the sequence, as with
+    /// #add_converted_member.
+    ///
+    /// \param name the name of the configuration
+    /// \param member the vector pointer-to-member to translate
+    /// \param converter the converter of each value read from the scheme
+    ///
+    /// \return reference to (*this) to allow chaining calls
+    template<typename U, typename Converter>
+    this_type& add_converted_vector_member( const key_string_type& name,
+                                            std::vector<U,AllocatorT<U>> value_type::*member,
+                                            Converter converter );
+
+    /// \brief Adds an enum pointer-to-member, translated from the names of
+    ///        its values
+    ///
+    /// The names are compiled into a perfect hash when this is called, so
+    /// translating the member hashes the string once and writes the matching
+    /// value directly into the member. The string is borrowed when the
+    /// scheme provides 'as_string_view', and read as a string_type
+    /// otherwise. Integer-coded input, such as "2", is accepted when it is
+    /// the value of one of the names; any other string leaves the member
+    /// untouched.
+    ///
+    /// \param name the name of the configuration
+    /// \param member the enum pointer-to-member to translate
+    /// \param values the name of each value of the enum
+    ///
+    /// \return reference to (*this) to allow chaining calls
+    template<typename E>
+    this_type& add_enum_member( const key_string_type& name,
+                                E value_type::*member,
+                                std::initializer_list<std::pair<string_type,E>> values );
+
     //-------------------------------------------------------------------------
     // Overloaded Member Loaders
     //-------------------------------------------------------------------------
@@ -247,6 +692,10 @@ namespace serial {
     this_type& add_member( const key_string_type& name,
                            string_member member );
 
+    /// \copydoc DataTranslator::add_string_view_member
+    this_type& add_member( const key_string_type& name,
+                           string_view_member member );
+
     // Vector types
 
     /// \copydoc DataTranslator::add_bool_vector_member
@@ -265,11 +714,59 @@ namespace serial {
     this_type& add_member( const key_string_type& name,
                            string_vector_member member );
 
+    /// \copydoc DataTranslator::add_string_view_vector_member
+    this_type& add_member( const key_string_type& name,
+                           string_view_vector_member member );
+
+    /// \brief Adds a pointer-to-member named by a hashed key
+    ///
+    /// This allows keys made with \c SERIAL_KEY to be registered without
+    /// being hashed at runtime. The kind of member is deduced in the same way
+    /// as the other overloads.
+    ///
+    /// \param name the hashed name of the configuration
+    /// \param member the pointer-to-member to translate
+    ///
+    /// \return reference to (*this) to allow chaining calls
+    template<typename U>
+    this_type& add_member( const hashed_key_type& name,
+                           U value_type::*member );
+
+    /// \copydoc DataTranslator::add_struct_member
+    template<typename U>
+    this_type& add_member( const key_string_type& name,
+                           U value_type::*member,
+                           const DataTranslator<U,BoolT,IntT,FloatT,StringT,KeyStringT,AllocatorT>& translator );
+
+    /// \copydoc DataTranslator::add_struct_vector_member
+    template<typename U>
+    this_type& add_member( const key_string_type& name,
+                           std::vector<U,AllocatorT<U>> value_type::*member,
+                           const DataTranslator<U,BoolT,IntT,FloatT,StringT,KeyStringT,AllocatorT>& translator );
+
+    /// \copydoc DataTranslator::add_converted_member
+    template<typename U, typename Converter>
+    this_type& add_member( const key_string_type& name,
+                           U value_type::*member,
+                           Converter converter );
+
+    /// \copydoc DataTranslator::add_converted_vector_member
+    template<typename U, typename Converter>
+    this_type& add_member( const key_string_type& name,
+                           std::vector<U,AllocatorT<U>> value_type::*member,
+                           Converter converter );
+
     /// \brief Checks if this DataTranslator already has a member with the
     ///        given key string name
     ///
+    /// \p name may be a key_string_type, a null-terminated character string,
+    /// or any contiguous string with \c data() and \c size() (such as a
+    /// string view) of the same character type; it is never converted to a
+    /// key_string_type.
+    ///
     /// \return \c true if this DataTranslator contains a member named \p name
-    bool has_member( const key_string_type& name );
+    template<typename Key>
+    bool has_member( const Key& name ) const;
 
     //-------------------------------------------------------------------------
     // Loaders
@@ -278,15 +775,44 @@ namespace serial {
 
     /// \brief Translates a data bin into a single data structure
     ///
+    /// By default, vector members are appended to. Translating with
+    /// translate_mode::replace instead overwrites the vector members that are
+    /// present in \p data while keeping their capacity, which allows
+    /// long-lived objects to be re-translated without reallocating.
+    ///
+    /// If the translator is frozen and \p data provides \c child(segment),
+    /// the key prefix trie is walked instead: each interior node is
+    /// resolved to a child scheme once, and members are requested from it
+    /// by the last segment of their key.
+    ///
+    /// Schemes that accept a \c hashed_key_type in place of a key string are
+    /// passed the key with the hash computed when the member was added.
+    ///
     /// \param object The object to be populated with data
     /// \param data   The data to translate into the structures
+    /// \param mode   How to treat the existing contents of vector members
     /// \return the number of members translated
     template<typename ScalarTranslationScheme>
     size_type translate( value_type* object,
-                         const ScalarTranslationScheme& data ) const;
+                         const ScalarTranslationScheme& data,
+                         translate_mode mode = translate_mode::append ) const;
+
+    /// \brief Resets every member of \p object that this translator
+    ///        translates
+    ///
+    /// String and vector members are cleared, keeping their capacity, and
+    /// all other members are value-initialized. This allows a scratch
+    /// object to be reused for each entry of a sequence.
+    ///
+    /// \param object the object to reset
+    void reset( value_type* object ) const;
 
     /// \brief Translates a single data bin into an array of structures
     ///
+    /// The first object is translated, and then copied to the rest of the
+    /// array; bitwise if value_type is trivially copyable, or through
+    /// copy-assignment otherwise. All objects must already be constructed.
+    ///
     /// \param objects Array of objects to be populated with data
     /// \param size    The size of the array to translate
     /// \param data    The binary data to translate into the structure
@@ -306,6 +832,44 @@ namespace serial {
     size_type translate_sequence( OutputIterator it,
                                   SequenceTranslationScheme& data ) const;
 
+    /// \brief Translates a sequence of structures, allocating the strings
+    ///        and vectors of the whole batch from \p arena
+    ///
+    /// \p arena is the current arena for the duration of the translation,
+    /// so that \c serial::arena_string members and \c arena_allocator
+    /// vectors are appended to it rather than individually allocated. The
+    /// translated objects are only valid until \p arena is released.
+    ///
+    /// \param it the output iterator to use for insertions
+    /// \param data the data to insert
+    /// \param arena the arena to allocate the batch from
+    /// \return the number of members translated in all entries
+    template<typename OutputIterator, typename SequenceTranslationScheme>
+    size_type translate_sequence( OutputIterator it,
+                                  SequenceTranslationScheme& data,
+                                  monotonic_arena& arena ) const;
+
+    /// \brief Translates a sequence of structures into \p objects, reusing
+    ///        the objects it already holds
+    ///
+    /// Each entry is translated in place, rather than into a temporary that
+    /// is moved into the output. The objects already in \p objects are
+    /// reset and re-translated, so their vector and string members keep
+    /// their capacity, and further objects are constructed at the end of
+    /// the container. Afterwards \p objects holds exactly one object per
+    /// entry.
+    ///
+    /// Keeping \p objects alive between batches makes it a pool of
+    /// recycled objects.
+    ///
+    /// \param objects the container to translate into, such as a
+    ///                \c std::vector or \c std::deque of value_type
+    /// \param data the data to insert
+    /// \return the number of members translated in all entries
+    template<typename Container, typename SequenceTranslationScheme>
+    size_type translate_sequence_into( Container& objects,
+                                       SequenceTranslationScheme& data ) const;
+
     /// \brief Translates a sequence of structures into the appropriate
     ///        data type with a bounded size
     ///
@@ -318,66 +882,486 @@ namespace serial {
                                   size_type size,
                                   SequenceTranslationScheme& data ) const;
 
+    /// \brief Translates a batch of independent data bins into an array of
+    ///        structures
+    ///
+    /// Unlike calling #translate for each object, the batch is translated
+    /// member-major: each plan entry is translated for every object before
+    /// moving to the next entry, which keeps the plan and its keys hot in
+    /// cache. Objects and schemes are prefetched ahead of use.
+    ///
+    /// \param objects Array of \p size objects to be populated with data
+    /// \param schemes Array of \p size schemes, one for each object
+    /// \param size    The number of objects to translate
+    /// \param mode    How to treat the existing contents of vector members
+    /// \return the number of members translated in all objects
+    template<typename ScalarTranslationScheme>
+    size_type translate_batch( value_type* objects,
+                               const ScalarTranslationScheme* schemes,
+                               size_type size,
+                               translate_mode mode = translate_mode::append ) const;
+
+    /// \brief Translates a data bin into a single data structure, driven by
+    ///        the keys that are present in the data bin
+    ///
+    /// Rather than querying \p data for every registered member, the scheme
+    /// enumerates its own keys and each one is dispatched to its members
+    /// through a hashed lookup. This is preferable for sparse data, where
+    /// only a few of many registered members are present.
+    ///
+    /// The scheme may pass its keys as any string type accepted by
+    /// #has_member, and they are passed back to the scheme unchanged.
+    ///
+    /// The lookup is built by #freeze; an unfrozen translator falls back on
+    /// a linear search for each key.
+    ///
+    /// \param object The object to be populated with data
+    /// \param data   The data to translate into the structures
+    /// \param mode   How to treat the existing contents of vector members
+    /// \return the number of members translated
+    template<typename PullTranslationScheme>
+    size_type translate_pull( value_type* object,
+                              const PullTranslationScheme& data,
+                              translate_mode mode = translate_mode::append ) const;
+
+    /// \brief Translates a random access sequence of structures in parallel
+    ///
+    /// Each entry \c data.at(i) is translated into \c it[i], so \p it must
+    /// refer to a preallocated range of at least \c data.count() objects.
+    /// Entries are distributed across \p threads worker threads, and the
+    /// order of the input is preserved in the output.
+    ///
+    /// \param it      the random access iterator to the output range
+    /// \param data    the data to translate
+    /// \param threads the number of threads to use, or 0 to use one per
+    ///                hardware thread
+    /// \return the number of members translated in all entries
+    template<typename RandomAccessIterator, typename RandomAccessSequenceTranslationScheme>
+    size_type translate_sequence_parallel( RandomAccessIterator it,
+                                           const RandomAccessSequenceTranslationScheme& data,
+                                           size_type threads = 0 ) const;
+
 
     //-------------------------------------------------------------------------
     // Private Member Types
     //-------------------------------------------------------------------------
   private:
 
-    // Scalar member mapping
-    typedef std::map<std::string, bool_member>   bool_member_map;
-    typedef std::map<std::string, int_member>    int_member_map;
-    typedef std::map<std::string, float_member>  float_member_map;
-    typedef std::map<std::string, string_member> string_member_map;
+    /// \brief A single entry in the translation plan
+    typedef detail::plan_entry<key_string_type,string_type> member_entry;
+
+    typedef std::vector<member_entry> member_plan;
+
+    /// \brief A node of the key prefix trie
+    ///
+    /// The children of a node, and its leaves, are stored contiguously
+    struct path_node
+    {
+      key_string_type segment;     ///< The key segment naming this node
+      size_type       first_child; ///< The first child in path_nodes
+      size_type       child_count; ///< The number of child nodes
+      size_type       first_leaf;  ///< The first leaf in path_leaves
+      size_type       leaf_count;  ///< The number of leaves
+    };
+
+    /// \brief A member at the end of a path in the key prefix trie
+    struct path_leaf
+    {
+      key_string_type segment; ///< The last segment of the member's key
+      std::uint64_t   hash;    ///< The hash of the segment
+      size_type       entry;   ///< The index of the member in members
+    };
+
+    /// \brief Translates each key enumerated by a pull scheme
+    template<typename TranslationScheme>
+    struct pull_key
+    {
+      const this_type*         translator; ///< The translator
+      value_type*              object;     ///< The object to translate into
+      const TranslationScheme* data;       ///< The scheme enumerating keys
+      translate_mode           mode;       ///< How to treat existing vectors
+      size_type*               count;      ///< The number of members translated
+
+      template<typename Key>
+      void operator()( const Key& name ) const
+      {
+        (*count) += translator->translate_key(object,name,*data,mode);
+      }
+    };
+
+    /// \brief A range of entries in the key index that share a key
+    struct key_group
+    {
+      size_type first;      ///< The first index in key_entries
+      size_type count;      ///< The number of entries with this key
+      size_type key_offset; ///< The offset of the key in key_table
+      size_type key_size;   ///< The number of characters in the key
+    };
+
+    /// \brief The registered members, and the indices built when frozen
+    ///
+    /// Plans are shared between copies of a translator, and are never
+    /// modified while shared; a translator that adds members or freezes
+    /// first takes a private copy of its plan.
+    struct plan_type
+    {
+      member_plan members;        ///< Flat plan of every registered member
+      bool        frozen = false; ///< Whether members is a frozen plan
+
+      // Key index, built when frozen
+      detail::perfect_hash   key_hash;    ///< Perfect hash of the distinct keys
+      std::vector<key_group> key_groups;  ///< The key group of each hash slot
+      std::vector<size_type> key_entries; ///< Plan entry indices, grouped by key
+
+      /// Every distinct key, interned into one contiguous buffer
+      detail::key_table<typename hashed_key_type::value_type> key_table;
 
-    // Vector member mapping
-    typedef std::map<std::string, bool_vector_member>   bool_vector_member_map;
-    typedef std::map<std::string, int_vector_member>    int_vector_member_map;
-    typedef std::map<std::string, float_vector_member>  float_vector_member_map;
-    typedef std::map<std::string, string_vector_member> string_vector_member_map;
+      // Key prefix trie, built when frozen
+      std::vector<path_node> path_nodes;  ///< Trie nodes; the root is first
+      std::vector<path_leaf> path_leaves; ///< Trie leaves, grouped by node
+    };
 
     //-------------------------------------------------------------------------
     // Private Members
     //-------------------------------------------------------------------------
   private:
 
-    // Scalar members
-    bool_member_map   m_bool_members;   ///< Map of bool member pointers
-    int_member_map    m_int_members;    ///< Map of int member pointers
-    float_member_map  m_float_members;  ///< Map of float member pointers
-    string_member_map m_string_members; ///< Map of string member pointers
+    /// The translation plan, shared with copies of this translator
+    std::shared_ptr<plan_type> m_plan = std::make_shared<plan_type>();
 
-    // Vector members
-    bool_vector_member_map   m_bool_vector_members;   ///< Vector of bool array member pointers
-    int_vector_member_map    m_int_vector_members;    ///< Vector of int array member pointers
-    float_vector_member_map  m_float_vector_members;  ///< Vector of float array member pointers
-    string_vector_member_map m_string_vector_members; ///< Vector of string array member pointers
+    /// \brief The keys prepared for a single scheme type
+    struct prepared_entry
+    {
+      const void*                 scheme; ///< The type id of the scheme
+      std::shared_ptr<const void> keys;   ///< The vector of prepared keys
+    };
+
+    std::vector<prepared_entry> m_prepared; ///< Prepared keys of each scheme type
+
+    // Nested structure members are flattened from the plans of translators
+    // of other types
+    template<typename,typename,typename,typename,typename,typename,template<typename> class>
+    friend class DataTranslator;
 
     //-------------------------------------------------------------------------
     // Private Member Functions
     //-------------------------------------------------------------------------
   private:
 
-    /// \brief Translate all scalar entries into the specified objects
+    /// \brief Gets the plan for modification, first copying it if it is
+    ///        shared with another translator
+    plan_type& detach_plan();
+
+    /// \brief Adds an entry to the plan, replacing any existing entry of the
+    ///        same kind and name
+    ///
+    /// \param name the name of the configuration
+    /// \param hash the hash of \p name
+    /// \param kind the kind of member being added
+    /// \param offset the byte offset of the member
+    void add_entry( const key_string_type& name,
+                    std::uint64_t hash,
+                    member_kind kind,
+                    size_type offset );
+
+    /// \brief Adds \p entry to the plan, replacing any existing entry of
+    ///        the same kind and name
+    ///
+    /// \param entry the entry to add
+    void add_entry( member_entry entry );
+
+    /// \brief Gets the kind of member translated into members of type \p U
+    template<typename U>
+    static constexpr member_kind kind_of() noexcept;
+
+    /// \brief Gets the characters of the key of \p entry, from the key table
+    ///        once frozen
+    const typename hashed_key_type::value_type*
+      key_chars( const member_entry& entry ) const noexcept;
+
+    /// \brief Gets the key to pass to a scheme for a key string
+    ///
+    /// \param key the key string
+    /// \param chars the characters of \p key to pass in a hashed key
+    /// \param hash the hash of \p key
+    /// \return \p chars with its hash if the scheme accepts hashed keys, or
+    ///         \p key otherwise
+    static hashed_key_type scheme_key( const key_string_type& key,
+                                       const typename hashed_key_type::value_type* chars,
+                                       std::uint64_t hash,
+                                       std::true_type ) noexcept;
+
+    static const key_string_type& scheme_key( const key_string_type& key,
+                                              const typename hashed_key_type::value_type* chars,
+                                              std::uint64_t hash,
+                                              std::false_type ) noexcept;
+
+    /// \brief Builds the perfect hash index of the plan's keys
+    void build_key_index();
+
+    /// \brief Builds the key prefix trie of the plan's keys
+    void build_path_index();
+
+    /// \brief Builds the trie node at \p node from the plan entries in
+    ///        \p entries, whose keys have been split into \p segments
+    ///
+    /// \param node the index of the node to build
+    /// \param depth the depth of the node, in segments
+    /// \param entries the plan entries below the node, in plan order
+    /// \param segments the key segments of every plan entry
+    void build_path_node( size_type node,
+                          size_type depth,
+                          const std::vector<size_type>& entries,
+                          const std::vector<std::vector<key_string_type>>& segments );
+
+    /// \brief Finds the plan entries named \p name in a frozen plan
+    ///
+    /// \param name the key of the entries to find
+    /// \return the range of indices into m_members of the entries
+    template<typename Key>
+    std::pair<const size_type*,const size_type*>
+      find_key( const Key& name ) const noexcept;
+
+    /// \brief Gets the keys prepared for the scheme type of \p data
+    ///
+    /// \param data the scheme being translated
+    /// \return the prepared keys, in plan order, or \c nullptr if the keys
+    ///         have not been prepared for this scheme type
+    template<typename TranslationScheme>
+    const std::vector<detail::prepared_key_t<TranslationScheme,key_string_type>>*
+      prepared_keys( const TranslationScheme& data, std::true_type ) const noexcept;
+
+    template<typename TranslationScheme>
+    const std::vector<key_string_type>*
+      prepared_keys( const TranslationScheme& data, std::false_type ) const noexcept;
+
+    /// \brief Translates every entry of the plan into \p object, walking the
+    ///        key prefix trie if \p data provides \c child(segment)
     ///
     /// \param object the object to translate data into
     /// \param data the data to translate
+    /// \param mode how to treat the existing contents of vectors
     ///
-    /// \return the number of scalars successfully translated
+    /// \return the number of entries successfully translated
     template<typename TranslationScheme>
-    size_type translate_scalar_data( value_type* object,
-                                     const TranslationScheme& data ) const;
+    size_type translate_keys( value_type* object,
+                              const TranslationScheme& data,
+                              translate_mode mode,
+                              std::true_type ) const;
 
-    /// \brief Translate all vector entries into the specified objects
+    template<typename TranslationScheme>
+    size_type translate_keys( value_type* object,
+                              const TranslationScheme& data,
+                              translate_mode mode,
+                              std::false_type ) const;
+
+    /// \brief Translates the members below a node of the key prefix trie
     ///
     /// \param object the object to translate data into
-    /// \param data the data to translate
+    /// \param node the trie node
+    /// \param data the scheme for the node
+    /// \param mode how to treat the existing contents of vectors
     ///
-    /// \return the number of vector successfully translated
+    /// \return the number of entries successfully translated
     template<typename TranslationScheme>
-    size_type translate_vector_data( value_type* object,
+    size_type translate_path( value_type* object,
+                              const path_node& node,
+                              const TranslationScheme& data,
+                              translate_mode mode ) const;
+
+    /// \brief Translates every entry of the plan into \p object
+    ///
+    /// \param object the object to translate data into
+    /// \param data the data to translate
+    /// \param mode how to treat the existing contents of vectors
+    /// \param key_of function returning the key of the plan entry at an index
+    ///
+    /// \return the number of entries successfully translated
+    template<typename TranslationScheme, typename KeyOf>
+    size_type translate_plan( value_type* object,
+                              const TranslationScheme& data,
+                              translate_mode mode,
+                              KeyOf key_of ) const;
+
+    /// \brief Translates every entry of the plan into each of \p objects,
+    ///        member-major
+    ///
+    /// \param objects the objects to translate data into
+    /// \param schemes the data to translate, one for each object
+    /// \param size the number of objects
+    /// \param mode how to treat the existing contents of vectors
+    /// \param key_of function returning the key of the plan entry at an index
+    ///
+    /// \return the number of entries successfully translated
+    template<typename TranslationScheme, typename KeyOf>
+    size_type translate_plan_batch( value_type* objects,
+                                    const TranslationScheme* schemes,
+                                    size_type size,
+                                    translate_mode mode,
+                                    KeyOf key_of ) const;
+
+    /// \brief Translate a single entry into the specified object
+    ///
+    /// \param object the object to translate data into
+    /// \param entry the plan entry to translate
+    /// \param key the key, or prepared key, of the entry
+    /// \param data the data to translate
+    /// \param mode how to treat the existing contents of vectors
+    ///
+    /// \return \c true if the entry was successfully translated
+    template<typename TranslationScheme, typename Key>
+    bool translate_member( value_type* object,
+                           const member_entry& entry,
+                           const Key& key,
+                           const TranslationScheme& data,
+                           translate_mode mode ) const;
+
+    /// \brief Translate every entry named \p name into the specified object
+    ///
+    /// \param object the object to translate data into
+    /// \param name the key of the entries to translate
+    /// \param data the data to translate
+    /// \param mode how to treat the existing contents of vectors
+    ///
+    /// \return the number of entries successfully translated
+    template<typename TranslationScheme, typename Key>
+    size_type translate_key( value_type* object,
+                             const Key& name,
+                             const TranslationScheme& data,
+                             translate_mode mode ) const;
+
+    /// \brief Translate a single scalar entry into the specified object
+    ///
+    /// \param object the object to translate data into
+    /// \param entry the plan entry to translate
+    /// \param key the key, or prepared key, of the entry
+    /// \param data the data to translate
+    ///
+    /// \return \c true if the scalar was successfully translated
+    template<typename TranslationScheme, typename Key>
+    bool translate_scalar_data( value_type* object,
+                                const member_entry& entry,
+                                const Key& key,
+                                const TranslationScheme& data ) const;
+
+    /// \brief Translate a single vector entry into the specified object
+    ///
+    /// \param object the object to translate data into
+    /// \param entry the plan entry to translate
+    /// \param key the key, or prepared key, of the entry
+    /// \param data the data to translate
+    /// \param mode how to treat the existing contents of the vector
+    ///
+    /// \return \c true if the vector was successfully translated
+    template<typename TranslationScheme, typename Key>
+    bool translate_vector_data( value_type* object,
+                                const member_entry& entry,
+                                const Key& key,
+                                const TranslationScheme& data,
+                                translate_mode mode ) const;
+
+    /// \brief Translate a single structure vector entry into the specified
+    ///        object
+    ///
+    /// \param object the object to translate data into
+    /// \param entry the plan entry to translate
+    /// \param key the key, or prepared key, of the entry
+    /// \param data the data to translate
+    /// \param mode how to treat the existing elements of the vector
+    ///
+    /// \return \c true if the vector was successfully translated
+    template<typename TranslationScheme, typename Key>
+    bool translate_element_data( value_type* object,
+                                 const member_entry& entry,
+                                 const Key& key,
+                                 const TranslationScheme& data,
+                                 translate_mode mode,
+                                 std::true_type ) const;
+
+    template<typename TranslationScheme, typename Key>
+    bool translate_element_data( value_type* object,
+                                 const member_entry& entry,
+                                 const Key& key,
+                                 const TranslationScheme& data,
+                                 translate_mode mode,
+                                 std::false_type ) const;
+
+    /// \brief Translate a single converted scalar entry into the specified
+    ///        object
+    ///
+    /// \param object the object to translate data into
+    /// \param entry the plan entry to translate
+    /// \param key the key, or prepared key, of the entry
+    /// \param data the data to translate
+    ///
+    /// \return \c true if the value was successfully read and converted
+    template<typename TranslationScheme, typename Key>
+    bool translate_converted_scalar( value_type* object,
+                                     const member_entry& entry,
+                                     const Key& key,
                                      const TranslationScheme& data ) const;
 
+    /// \brief Translate a single converted vector entry into the specified
+    ///        object
+    ///
+    /// \param object the object to translate data into
+    /// \param entry the plan entry to translate
+    /// \param key the key, or prepared key, of the entry
+    /// \param data the data to translate
+    /// \param mode how to treat the existing contents of the vector
+    ///
+    /// \return \c true if the sequence was successfully read and converted
+    template<typename TranslationScheme, typename Key>
+    bool translate_converted_vector( value_type* object,
+                                     const member_entry& entry,
+                                     const Key& key,
+                                     const TranslationScheme& data,
+                                     translate_mode mode ) const;
+
+    /// \brief Translate a single enum entry into the specified object
+    ///
+    /// \param object the object to translate data into
+    /// \param entry the plan entry to translate
+    /// \param key the key, or prepared key, of the entry
+    /// \param data the data to translate
+    ///
+    /// \return \c true if the string named a value of the enum
+    template<typename TranslationScheme, typename Key>
+    bool translate_enum_data( value_type* object,
+                              const member_entry& entry,
+                              const Key& key,
+                              const TranslationScheme& data,
+                              std::true_type ) const;
+
+    template<typename TranslationScheme, typename Key>
+    bool translate_enum_data( value_type* object,
+                              const member_entry& entry,
+                              const Key& key,
+                              const TranslationScheme& data,
+                              std::false_type ) const;
+
+    /// \brief Resets the member of a single entry of the specified object
+    ///
+    /// \param object the object containing the member
+    /// \param entry the plan entry to reset
+    static void reset_member( value_type* object,
+                              const member_entry& entry );
+
+    /// \brief Computes the byte offset of \p member within value_type
+    ///
+    /// \param member the pointer-to-member to resolve
+    /// \return the offset of the member in bytes
+    template<typename U>
+    static size_type offset_of( U value_type::*member ) noexcept;
+
+    /// \brief Accesses the member of type \p U at \p offset in \p object
+    ///
+    /// \param object the object containing the member
+    /// \param offset the byte offset of the member
+    /// \return reference to the member
+    template<typename U>
+    static U& member_at( value_type* object, size_type offset ) noexcept;
+
   };
 
 } // namespace serial
@@ -0,0 +1,177 @@
+/**
+ * \file HashedKey.hpp
+ *
+ * \brief This header contains keys whose hash is computed at compile time.
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ * \copyright Matthew Rodusek
+ */
+
+/*
+ * The MIT License (MIT)
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2016 Matthew Rodusek <http://rodusek.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef DATATRANSLATOR_HASHEDKEY_HPP_
+#define DATATRANSLATOR_HASHEDKEY_HPP_
+
+#if __cplusplus < 201103L
+# error This file requires compiler and library support for the ISO C++11 standard.
+#endif
+
+#include "detail/key.inl"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace serial {
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \class serial::basic_hashed_key
+  ///
+  /// \brief A non-owning key string that carries its FNV-1a hash
+  ///
+  /// Hashed keys are passed to translation schemes that accept them in
+  /// place of key strings, so that schemes which index their nodes by the
+  /// same hash can skip hashing the key. The hash is the one computed by
+  /// \c serial::detail::hash_key.
+  ///
+  /// Keys made from string literals with \c SERIAL_KEY are hashed at compile
+  /// time.
+  ///
+  /// \tparam CharT the character type of the key
+  ////////////////////////////////////////////////////////////////////////////
+  template<typename CharT>
+  class basic_hashed_key
+  {
+    //------------------------------------------------------------------------
+    // Public Member Types
+    //------------------------------------------------------------------------
+  public:
+
+    typedef CharT       value_type; ///< The character type of the key
+    typedef std::size_t size_type;  ///< Size type
+
+    //------------------------------------------------------------------------
+    // Constructors
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Hashes the null-terminated string \p key
+    ///
+    /// \param key the key, which must outlive this hashed key
+    explicit constexpr basic_hashed_key( const CharT* key ) noexcept
+      : m_data(key),
+        m_size(length(key)),
+        m_hash(detail::hash_literal(key))
+    {
+
+    }
+
+    /// \brief Constructs a hashed key from a key and its precomputed hash
+    ///
+    /// \param key  the key, which must outlive this hashed key
+    /// \param size the number of characters in \p key
+    /// \param hash the hash of \p key
+    constexpr basic_hashed_key( const CharT* key,
+                                size_type size,
+                                std::uint64_t hash ) noexcept
+      : m_data(key),
+        m_size(size),
+        m_hash(hash)
+    {
+
+    }
+
+    //------------------------------------------------------------------------
+    // Observers
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the characters of the key, which are not null-terminated
+    constexpr const CharT* data() const noexcept{ return m_data; }
+
+    /// \brief Gets the number of characters in the key
+    constexpr size_type size() const noexcept{ return m_size; }
+
+    /// \brief Gets the hash of the key
+    constexpr std::uint64_t hash() const noexcept{ return m_hash; }
+
+    //------------------------------------------------------------------------
+    // Private Members
+    //------------------------------------------------------------------------
+  private:
+
+    const CharT*  m_data; ///< The characters of the key
+    size_type     m_size; ///< The number of characters in the key
+    std::uint64_t m_hash; ///< The hash of the key
+
+    static constexpr size_type length( const CharT* key ) noexcept
+    {
+      return (*key == CharT()) ? 0 : 1 + length(key + 1);
+    }
+  };
+
+  typedef basic_hashed_key<char>     hashed_key;
+  typedef basic_hashed_key<wchar_t>  whashed_key;
+  typedef basic_hashed_key<char16_t> u16hashed_key;
+  typedef basic_hashed_key<char32_t> u32hashed_key;
+
+  /// \brief Compares the characters of two hashed keys
+  template<typename CharT>
+  inline bool operator==( const basic_hashed_key<CharT>& lhs,
+                          const basic_hashed_key<CharT>& rhs ) noexcept
+  {
+    return lhs.hash() == rhs.hash() && detail::key_equal(lhs, rhs);
+  }
+
+  template<typename CharT>
+  inline bool operator!=( const basic_hashed_key<CharT>& lhs,
+                          const basic_hashed_key<CharT>& rhs ) noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+  namespace detail {
+
+    /// \brief Makes a hashed key from a string literal and its hash
+    template<typename CharT, std::size_t N>
+    constexpr basic_hashed_key<CharT> make_hashed_key( const CharT (&key)[N],
+                                                       std::uint64_t hash ) noexcept
+    {
+      return basic_hashed_key<CharT>( key, N - 1, hash );
+    }
+
+  } // namespace detail
+} // namespace serial
+
+/// \brief Makes a \c serial::basic_hashed_key from a string literal, hashed
+///        at compile time
+///
+/// \param literal the string literal of the key
+#define SERIAL_KEY(literal) \
+  ::serial::detail::make_hashed_key( literal, ::std::integral_constant< ::std::uint64_t, ::serial::detail::hash_literal(literal)>::value )
+
+#endif /* DATATRANSLATOR_HASHEDKEY_HPP_ */
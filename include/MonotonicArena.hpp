@@ -0,0 +1,389 @@
+/**
+ * \file MonotonicArena.hpp
+ *
+ * \brief This header contains an arena and allocator for translating
+ *        objects whose memory is released in bulk.
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ * \copyright Matthew Rodusek
+ */
+
+/*
+ * The MIT License (MIT)
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2016 Matthew Rodusek <http://rodusek.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef DATATRANSLATOR_MONOTONICARENA_HPP_
+#define DATATRANSLATOR_MONOTONICARENA_HPP_
+
+#if __cplusplus < 201103L
+# error This file requires compiler and library support for the ISO C++11 standard.
+#endif
+
+#include "detail/key.inl"
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+
+namespace serial {
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \class serial::monotonic_arena
+  ///
+  /// \brief An arena that hands out memory from large blocks, and only frees
+  ///        it all at once
+  ///
+  /// Deallocation is a no-op; every block is freed by #release or when the
+  /// arena is destroyed. This suits translating a burst of objects that are
+  /// all discarded together.
+  ///
+  /// An arena is made the current arena of a thread with an \c arena_scope,
+  /// which default-constructed \c arena_allocator instances allocate from.
+  ///
+  /// Example use:
+  /// \code
+  /// serial::monotonic_arena arena;
+  /// {
+  ///   serial::arena_scope scope(arena);
+  ///   translator.translate_sequence(std::back_inserter(objects), data);
+  ///   ...
+  ///   objects.clear();
+  /// }
+  /// arena.release();
+  /// \endcode
+  ////////////////////////////////////////////////////////////////////////////
+  class monotonic_arena
+  {
+    //------------------------------------------------------------------------
+    // Public Member Types
+    //------------------------------------------------------------------------
+  public:
+
+    typedef std::size_t size_type; ///< Size type
+
+    /// The default number of bytes in each block
+    static constexpr size_type default_block_size = 64 * 1024;
+
+    //------------------------------------------------------------------------
+    // Constructors / Destructor
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an arena that allocates blocks of \p block_size
+    ///        bytes
+    ///
+    /// \param block_size the number of bytes in each block
+    /// \param huge_pages whether to back blocks with huge pages, where the
+    ///                   platform supports it. Blocks are then rounded up
+    ///                   to a multiple of the huge page size.
+    explicit monotonic_arena( size_type block_size = default_block_size,
+                              bool huge_pages = false ) noexcept;
+
+    monotonic_arena( const monotonic_arena& ) = delete;
+    monotonic_arena& operator=( const monotonic_arena& ) = delete;
+
+    /// \brief Frees every block of the arena
+    ~monotonic_arena();
+
+    //------------------------------------------------------------------------
+    // Allocation
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Allocates \p size bytes aligned to \p alignment
+    ///
+    /// \throws std::bad_alloc if a new block cannot be allocated
+    ///
+    /// \param size the number of bytes to allocate
+    /// \param alignment the alignment of the allocation; a power of two
+    /// \return pointer to the allocated memory
+    void* allocate( size_type size, size_type alignment );
+
+    /// \brief Frees every block of the arena, invalidating all memory that
+    ///        was allocated from it
+    void release() noexcept;
+
+    /// \brief Gets the number of bytes allocated from the arena since it was
+    ///        constructed or last released
+    size_type allocated() const noexcept;
+
+    /// \brief Gets the arena of the innermost \c arena_scope of the calling
+    ///        thread
+    ///
+    /// \return the current arena, or \c nullptr if there is none
+    static monotonic_arena* current() noexcept;
+
+    //------------------------------------------------------------------------
+    // Private Member Types
+    //------------------------------------------------------------------------
+  private:
+
+    /// \brief The header at the start of every block
+    struct block
+    {
+      block*    next;   ///< The previously allocated block
+      size_type size;   ///< The number of bytes in the block
+      bool      mapped; ///< Whether the block was mapped with huge pages
+    };
+
+    //------------------------------------------------------------------------
+    // Private Members
+    //------------------------------------------------------------------------
+  private:
+
+    block*         m_blocks;     ///< The most recently allocated block
+    unsigned char* m_cursor;     ///< The next free byte of m_blocks
+    unsigned char* m_end;        ///< The end of m_blocks
+    size_type      m_block_size; ///< The size of each block
+    size_type      m_allocated;  ///< The number of bytes allocated
+    bool           m_huge_pages; ///< Whether to back blocks with huge pages
+
+    //------------------------------------------------------------------------
+    // Private Member Functions
+    //------------------------------------------------------------------------
+  private:
+
+    /// \brief Allocates a new block of at least \p size bytes
+    block* allocate_block( size_type size );
+
+    /// \brief Frees a block allocated with #allocate_block
+    static void free_block( block* b ) noexcept;
+
+    /// \brief Gets the arena pointer of the calling thread
+    static monotonic_arena*& current_arena() noexcept;
+
+    friend class arena_scope;
+  };
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \class serial::arena_scope
+  ///
+  /// \brief Makes an arena the current arena of the calling thread for the
+  ///        lifetime of the scope
+  ///
+  /// Scopes nest; the previous arena is restored when the scope ends.
+  ////////////////////////////////////////////////////////////////////////////
+  class arena_scope
+  {
+  public:
+
+    /// \brief Makes \p arena the current arena
+    explicit arena_scope( monotonic_arena& arena ) noexcept;
+
+    arena_scope( const arena_scope& ) = delete;
+    arena_scope& operator=( const arena_scope& ) = delete;
+
+    /// \brief Restores the previous arena
+    ~arena_scope();
+
+  private:
+
+    monotonic_arena* m_previous; ///< The arena to restore
+  };
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \class serial::arena_allocator
+  ///
+  /// \brief An allocator that allocates from a \c monotonic_arena
+  ///
+  /// A default-constructed allocator uses the current arena of the thread
+  /// that constructed it, or the global heap if there is none. Containers
+  /// and strings of translated objects that use this allocator therefore
+  /// allocate from the arena of the enclosing \c arena_scope, including
+  /// those in objects constructed by \c DataTranslator::translate_sequence.
+  ///
+  /// \tparam T the type to allocate
+  ////////////////////////////////////////////////////////////////////////////
+  template<typename T>
+  class arena_allocator
+  {
+    //------------------------------------------------------------------------
+    // Public Member Types
+    //------------------------------------------------------------------------
+  public:
+
+    typedef T           value_type; ///< The type to allocate
+    typedef std::size_t size_type;  ///< Size type
+
+    template<typename U>
+    struct rebind{ typedef arena_allocator<U> other; };
+
+    //------------------------------------------------------------------------
+    // Constructors
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an allocator using the current arena
+    arena_allocator() noexcept;
+
+    /// \brief Constructs an allocator using \p arena, or the global heap if
+    ///        it is \c nullptr
+    explicit arena_allocator( monotonic_arena* arena ) noexcept;
+
+    template<typename U>
+    arena_allocator( const arena_allocator<U>& other ) noexcept;
+
+    //------------------------------------------------------------------------
+    // Allocation
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Allocates storage for \p n objects
+    T* allocate( size_type n );
+
+    /// \brief Deallocates storage for \p n objects; a no-op for arena
+    ///        memory, which is released with the arena
+    void deallocate( T* p, size_type n ) noexcept;
+
+    /// \brief Gets the arena of this allocator
+    monotonic_arena* arena() const noexcept;
+
+    //------------------------------------------------------------------------
+    // Private Members
+    //------------------------------------------------------------------------
+  private:
+
+    monotonic_arena* m_arena; ///< The arena, or nullptr for the global heap
+  };
+
+  template<typename T, typename U>
+  bool operator==( const arena_allocator<T>& lhs, const arena_allocator<U>& rhs ) noexcept;
+
+  template<typename T, typename U>
+  bool operator!=( const arena_allocator<T>& lhs, const arena_allocator<U>& rhs ) noexcept;
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \class serial::basic_arena_string
+  ///
+  /// \brief A compact, immutable string whose characters are stored in a
+  ///        \c monotonic_arena
+  ///
+  /// Arena strings are only a pointer and a size. Converting a string to an
+  /// arena string appends its characters to the current arena, so all the
+  /// strings translated in a batch share the arena's blocks and are freed
+  /// with it, rather than each owning a separate allocation. Destroying an
+  /// arena string frees nothing.
+  ///
+  /// Arena strings are only valid until their arena is released.
+  ///
+  /// \tparam CharT the character type of the string
+  ////////////////////////////////////////////////////////////////////////////
+  template<typename CharT>
+  class basic_arena_string
+  {
+    //------------------------------------------------------------------------
+    // Public Member Types
+    //------------------------------------------------------------------------
+  public:
+
+    typedef CharT        value_type;     ///< The character type of the string
+    typedef std::size_t  size_type;      ///< Size type
+    typedef const CharT* const_iterator; ///< Iterator over the characters
+
+    //------------------------------------------------------------------------
+    // Constructors
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an empty string, without allocating
+    basic_arena_string() noexcept;
+
+    /// \brief Copies \p str into the current arena
+    ///
+    /// \throws std::logic_error if the calling thread has no current arena
+    ///
+    /// \param str the string to copy; a character string, or any contiguous
+    ///            string with \c data() and \c size()
+    template<typename StringT,
+             typename = typename std::enable_if<!std::is_same<typename std::decay<StringT>::type,basic_arena_string>::value>::type>
+    basic_arena_string( const StringT& str );
+
+    /// \brief Copies \p str into \p arena
+    ///
+    /// \param arena the arena to copy into
+    /// \param str   the string to copy
+    template<typename StringT>
+    basic_arena_string( monotonic_arena& arena, const StringT& str );
+
+    //------------------------------------------------------------------------
+    // Observers
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the null-terminated characters of the string
+    const CharT* data() const noexcept;
+    const CharT* c_str() const noexcept;
+    size_type size() const noexcept;
+    bool empty() const noexcept;
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    /// \brief Copies the characters of the string into an owning string
+    template<typename Traits, typename Allocator>
+    explicit operator std::basic_string<CharT,Traits,Allocator>() const;
+
+    //------------------------------------------------------------------------
+    // Comparison
+    //------------------------------------------------------------------------
+  public:
+
+    friend bool operator==( const basic_arena_string& lhs, const basic_arena_string& rhs ) noexcept
+    {
+      return detail::key_equal(lhs, rhs);
+    }
+
+    friend bool operator!=( const basic_arena_string& lhs, const basic_arena_string& rhs ) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+    //------------------------------------------------------------------------
+    // Private Members
+    //------------------------------------------------------------------------
+  private:
+
+    const CharT* m_data; ///< The characters, or nullptr if empty
+    size_type    m_size; ///< The number of characters
+
+    /// \brief Copies the \p size characters at \p str into \p arena
+    static const CharT* copy( monotonic_arena& arena, const CharT* str, size_type size );
+
+    /// \brief Gets the current arena, throwing if there is none
+    static monotonic_arena& current_arena();
+  };
+
+  typedef basic_arena_string<char>     arena_string;
+  typedef basic_arena_string<wchar_t>  warena_string;
+  typedef basic_arena_string<char16_t> u16arena_string;
+  typedef basic_arena_string<char32_t> u32arena_string;
+
+} // namespace serial
+
+#include "detail/MonotonicArena.inl"
+
+#endif /* DATATRANSLATOR_MONOTONICARENA_HPP_ */
@@ -0,0 +1,231 @@
+/**
+ * \file StaticDataTranslator.hpp
+ *
+ * \brief This header contains a translator whose members are known at compile time.
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ * \copyright Matthew Rodusek
+ */
+
+/*
+ * The MIT License (MIT)
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2016 Matthew Rodusek <http://rodusek.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef DATATRANSLATOR_STATICDATATRANSLATOR_HPP_
+#define DATATRANSLATOR_STATICDATATRANSLATOR_HPP_
+
+#if __cplusplus < 201103L
+# error This file requires compiler and library support for the ISO C++11 standard.
+#endif
+
+#include "DataTranslator.hpp"
+
+#include <type_traits>
+#include <vector>
+
+namespace serial {
+  namespace detail {
+
+    template<typename Member>
+    struct member_pointer_traits;
+
+    template<typename Member>
+    struct default_member_kind;
+
+  } // namespace detail
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \class serial::static_member
+  ///
+  /// \brief A compile-time description of a single member to translate
+  ///
+  /// \p Key must be a type with a static function \c value() that returns
+  /// the key to request from the translation scheme. The \c SERIAL_STATIC_KEY
+  /// macro defines such a type from a string literal.
+  ///
+  /// The \p Kind is deduced from the member type in the same way that the
+  /// overloaded \c DataTranslator::add_member resolves; it only needs to be
+  /// given explicitly when two of the translated types are the same.
+  ///
+  /// \tparam Key    the key type
+  /// \tparam Member the pointer-to-member type
+  /// \tparam Ptr    the pointer-to-member to translate into
+  /// \tparam Kind   the kind of member to translate
+  ////////////////////////////////////////////////////////////////////////////
+  template<typename Key,
+           typename Member,
+           Member Ptr,
+           member_kind Kind = detail::default_member_kind<Member>::value>
+  struct static_member
+  {
+    typedef Key key_type;
+    typedef typename detail::member_pointer_traits<Member>::class_type  class_type;
+    typedef typename detail::member_pointer_traits<Member>::member_type member_type;
+
+    static constexpr member_kind kind = Kind;
+
+    /// \brief Translates this member of \p object from \p data
+    ///
+    /// \param object the object to translate into
+    /// \param data   the data to translate
+    /// \param mode   how to treat the existing contents of vector members
+    /// \return \c true if the member was translated
+    template<typename TranslationScheme>
+    static bool translate( class_type& object,
+                           const TranslationScheme& data,
+                           translate_mode mode );
+
+    /// \brief Resets this member of \p object
+    ///
+    /// \param object the object to reset
+    static void reset( class_type& object );
+  };
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \class serial::StaticDataTranslator
+  ///
+  /// \brief Translates data from a given data bin into the supplied \p T
+  ///        type using a member list that is fixed at compile time.
+  ///
+  /// Unlike \c DataTranslator, constructing a \c StaticDataTranslator does
+  /// not allocate and has no runtime initialization, and every member
+  /// assignment is visible to the compiler for inlining.
+  ///
+  /// Example use:
+  /// \code
+  /// SERIAL_STATIC_KEY(entry_key, "my.entry");
+  /// SERIAL_STATIC_KEY(other_key, "my.other.entry");
+  ///
+  /// constexpr StaticDataTranslator<
+  ///   MyStruct,
+  ///   SERIAL_STATIC_MEMBER(entry_key, &MyStruct::entry),
+  ///   SERIAL_STATIC_MEMBER(other_key, &MyStruct::other_entry)
+  /// > translator{};
+  ///
+  /// MyStruct to_be_populated;
+  /// translator.translate(&to_be_populated, SomeTranslator(data));
+  /// \endcode
+  ///
+  /// \tparam T       The type to translate into
+  /// \tparam Members The \c static_member entries to translate
+  ////////////////////////////////////////////////////////////////////////////
+  template<typename T, typename...Members>
+  class StaticDataTranslator final
+  {
+    //------------------------------------------------------------------------
+    // Public Member Types
+    //------------------------------------------------------------------------
+  public:
+
+    typedef StaticDataTranslator<T,Members...> this_type;
+
+    typedef T           value_type;      ///< Type of this Data Translator
+    typedef T*          pointer;         ///< Type representing pointer
+    typedef const T*    const_pointer;   ///< Type representing constant pointer
+    typedef T&          reference;       ///< Type representing reference
+    typedef const T&    const_reference; ///< Type representing constant reference
+    typedef std::size_t size_type;       ///< Size type
+
+    //-------------------------------------------------------------------------
+    // Constructor
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs the (stateless) static translator
+    constexpr StaticDataTranslator() noexcept {}
+
+    //-------------------------------------------------------------------------
+    // Capacity
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets total number of members this \c StaticDataTranslator will
+    ///        translate
+    ///
+    /// \return the total number of members to translate
+    static constexpr size_type members() noexcept;
+
+    //-------------------------------------------------------------------------
+    // Loaders
+    //-------------------------------------------------------------------------
+  public:
+
+    /// \copydoc DataTranslator::translate
+    template<typename ScalarTranslationScheme>
+    size_type translate( value_type* object,
+                         const ScalarTranslationScheme& data,
+                         translate_mode mode = translate_mode::append ) const;
+
+    /// \copydoc DataTranslator::reset
+    void reset( value_type* object ) const;
+
+    /// \copydoc DataTranslator::translate_uniform
+    template<typename ScalarTranslationScheme>
+    size_type translate_uniform( value_type* objects,
+                                 size_type size,
+                                 const ScalarTranslationScheme& data ) const;
+
+    /// \copydoc DataTranslator::translate_sequence(OutputIterator,SequenceTranslationScheme&) const
+    template<typename OutputIterator, typename SequenceTranslationScheme>
+    size_type translate_sequence( OutputIterator it,
+                                  SequenceTranslationScheme& data ) const;
+
+    /// \copydoc DataTranslator::translate_sequence(OutputIterator,size_type,SequenceTranslationScheme&) const
+    template<typename OutputIterator, typename SequenceTranslationScheme>
+    size_type translate_sequence( OutputIterator it,
+                                  size_type size,
+                                  SequenceTranslationScheme& data ) const;
+
+    /// \copydoc DataTranslator::translate_sequence_into
+    template<typename Container, typename SequenceTranslationScheme>
+    size_type translate_sequence_into( Container& objects,
+                                       SequenceTranslationScheme& data ) const;
+
+    /// \copydoc DataTranslator::translate_sequence_parallel
+    template<typename RandomAccessIterator, typename RandomAccessSequenceTranslationScheme>
+    size_type translate_sequence_parallel( RandomAccessIterator it,
+                                           const RandomAccessSequenceTranslationScheme& data,
+                                           size_type threads = 0 ) const;
+  };
+
+} // namespace serial
+
+/// \brief Defines a key type named \p name for use with \c static_member
+///
+/// \param name    the name of the key type to define
+/// \param literal the string literal of the key
+#define SERIAL_STATIC_KEY(name,literal) \
+  struct name { static constexpr const char* value() noexcept { return literal; } }
+
+/// \brief Names the \c static_member type translating \p member with \p key
+///
+/// \param key    the key type, defined with \c SERIAL_STATIC_KEY
+/// \param member the pointer-to-member to translate
+#define SERIAL_STATIC_MEMBER(key,member) \
+  ::serial::static_member<key,decltype(member),member>
+
+#include "detail/StaticDataTranslator.inl"
+
+#endif /* DATATRANSLATOR_STATICDATATRANSLATOR_HPP_ */
@@ -0,0 +1,299 @@
+/**
+ * \file StringPool.hpp
+ *
+ * \brief This header contains a pool that interns translated string values,
+ *        so that repeated values share a single copy.
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ * \copyright Matthew Rodusek
+ */
+
+/*
+ * The MIT License (MIT)
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2016 Matthew Rodusek <http://rodusek.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef DATATRANSLATOR_STRINGPOOL_HPP_
+#define DATATRANSLATOR_STRINGPOOL_HPP_
+
+#if __cplusplus < 201103L
+# error This file requires compiler and library support for the ISO C++11 standard.
+#endif
+
+#include "detail/key.inl"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+namespace serial {
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \class serial::basic_string_pool
+  ///
+  /// \brief A thread-safe pool that stores a single copy of each distinct
+  ///        string interned into it
+  ///
+  /// The pool is split into independently locked shards, selected by the
+  /// hash of each string, so that threads interning different strings
+  /// rarely contend. Interned strings are never moved, so references to
+  /// them remain valid until the pool is cleared or destroyed.
+  ///
+  /// A pool is made the current pool of a thread with a \c basic_intern_scope;
+  /// otherwise the process-wide #global pool is current.
+  ///
+  /// \tparam CharT the character type of the strings
+  ////////////////////////////////////////////////////////////////////////////
+  template<typename CharT>
+  class basic_string_pool
+  {
+    //------------------------------------------------------------------------
+    // Public Member Types
+    //------------------------------------------------------------------------
+  public:
+
+    typedef std::basic_string<CharT> string_type; ///< The type of interned strings
+    typedef std::size_t              size_type;   ///< Size type
+
+    /// The number of independently locked shards of the pool
+    static constexpr size_type shard_count = 16;
+
+    //------------------------------------------------------------------------
+    // Constructors
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an empty pool
+    basic_string_pool() = default;
+
+    basic_string_pool( const basic_string_pool& ) = delete;
+    basic_string_pool& operator=( const basic_string_pool& ) = delete;
+
+    //------------------------------------------------------------------------
+    // Interning
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Interns the characters of \p str
+    ///
+    /// \param str the string to intern; a character string, or any
+    ///            contiguous string with \c data() and \c size()
+    /// \return reference to the pooled copy of \p str
+    template<typename StringT>
+    const string_type& intern( const StringT& str );
+
+    /// \brief Gets the number of distinct strings in the pool
+    size_type size() const;
+
+    /// \brief Removes every string from the pool, invalidating all
+    ///        references to them
+    void clear();
+
+    /// \brief Gets the process-wide pool
+    static basic_string_pool& global();
+
+    /// \brief Gets the pool of the innermost \c basic_intern_scope of the
+    ///        calling thread, or the #global pool if there is none
+    static basic_string_pool& current() noexcept;
+
+    //------------------------------------------------------------------------
+    // Private Member Types
+    //------------------------------------------------------------------------
+  private:
+
+    /// \brief An independently locked part of the pool
+    struct shard
+    {
+      mutable std::mutex                                  mutex;   ///< Guards strings
+      std::unordered_multimap<std::uint64_t,string_type> strings; ///< The strings, by hash
+    };
+
+    //------------------------------------------------------------------------
+    // Private Members
+    //------------------------------------------------------------------------
+  private:
+
+    shard m_shards[shard_count]; ///< The shards of the pool
+
+    /// \brief Gets the scoped pool pointer of the calling thread
+    static basic_string_pool*& current_pool() noexcept;
+
+    template<typename> friend class basic_intern_scope;
+  };
+
+  typedef basic_string_pool<char>     string_pool;
+  typedef basic_string_pool<wchar_t>  wstring_pool;
+  typedef basic_string_pool<char16_t> u16string_pool;
+  typedef basic_string_pool<char32_t> u32string_pool;
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \class serial::basic_intern_scope
+  ///
+  /// \brief Makes a pool the current pool of the calling thread for the
+  ///        lifetime of the scope
+  ///
+  /// Scopes nest; the previous pool is restored when the scope ends.
+  ////////////////////////////////////////////////////////////////////////////
+  template<typename CharT>
+  class basic_intern_scope
+  {
+  public:
+
+    /// \brief Makes \p pool the current pool
+    explicit basic_intern_scope( basic_string_pool<CharT>& pool ) noexcept;
+
+    basic_intern_scope( const basic_intern_scope& ) = delete;
+    basic_intern_scope& operator=( const basic_intern_scope& ) = delete;
+
+    /// \brief Restores the previous pool
+    ~basic_intern_scope();
+
+  private:
+
+    basic_string_pool<CharT>* m_previous; ///< The pool to restore
+  };
+
+  typedef basic_intern_scope<char>     intern_scope;
+  typedef basic_intern_scope<wchar_t>  wintern_scope;
+  typedef basic_intern_scope<char16_t> u16intern_scope;
+  typedef basic_intern_scope<char32_t> u32intern_scope;
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \class serial::basic_interned_string
+  ///
+  /// \brief A handle to a string in a \c basic_string_pool
+  ///
+  /// Interned strings are used as the string type of a \c DataTranslator so
+  /// that repeated string values, in string and string vector members, all
+  /// share the one pooled copy. Converting a string to an interned string
+  /// interns it into the current pool; copying a handle copies a pointer.
+  ///
+  /// Handles are only valid for as long as the pool they were interned
+  /// into is alive and has not been cleared.
+  ///
+  /// \tparam CharT the character type of the string
+  ////////////////////////////////////////////////////////////////////////////
+  template<typename CharT>
+  class basic_interned_string
+  {
+    //------------------------------------------------------------------------
+    // Public Member Types
+    //------------------------------------------------------------------------
+  public:
+
+    typedef CharT                    value_type;  ///< The character type of the string
+    typedef std::size_t              size_type;   ///< Size type
+    typedef std::basic_string<CharT> string_type; ///< The type of the pooled string
+    typedef const CharT*             const_iterator; ///< Iterator over the characters
+
+    //------------------------------------------------------------------------
+    // Constructors
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an empty string, without interning it
+    basic_interned_string() noexcept;
+
+    /// \brief Interns \p str into the current pool
+    ///
+    /// \param str the string to intern; a character string, or any
+    ///            contiguous string with \c data() and \c size()
+    template<typename StringT,
+             typename = typename std::enable_if<!std::is_same<typename std::decay<StringT>::type,basic_interned_string>::value>::type>
+    basic_interned_string( const StringT& str );
+
+    /// \brief Interns \p str into \p pool
+    ///
+    /// \param pool the pool to intern into
+    /// \param str  the string to intern
+    template<typename StringT>
+    basic_interned_string( basic_string_pool<CharT>& pool, const StringT& str );
+
+    //------------------------------------------------------------------------
+    // Observers
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the pooled string
+    const string_type& str() const noexcept;
+
+    const CharT* data() const noexcept;
+    const CharT* c_str() const noexcept;
+    size_type size() const noexcept;
+    bool empty() const noexcept;
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    /// \brief Converts to a reference to the pooled string
+    operator const string_type&() const noexcept;
+
+    //------------------------------------------------------------------------
+    // Private Members
+    //------------------------------------------------------------------------
+  private:
+
+    const string_type* m_string; ///< The pooled string, or nullptr if empty
+
+    /// \brief Gets the string that empty handles refer to
+    static const string_type& empty_string() noexcept;
+  };
+
+  typedef basic_interned_string<char>     interned_string;
+  typedef basic_interned_string<wchar_t>  winterned_string;
+  typedef basic_interned_string<char16_t> u16interned_string;
+  typedef basic_interned_string<char32_t> u32interned_string;
+
+  template<typename CharT>
+  bool operator==( const basic_interned_string<CharT>& lhs,
+                   const basic_interned_string<CharT>& rhs ) noexcept;
+
+  template<typename CharT>
+  bool operator==( const basic_interned_string<CharT>& lhs,
+                   const std::basic_string<CharT>& rhs ) noexcept;
+
+  template<typename CharT>
+  bool operator==( const std::basic_string<CharT>& lhs,
+                   const basic_interned_string<CharT>& rhs ) noexcept;
+
+  template<typename CharT>
+  bool operator!=( const basic_interned_string<CharT>& lhs,
+                   const basic_interned_string<CharT>& rhs ) noexcept;
+
+  template<typename CharT>
+  bool operator!=( const basic_interned_string<CharT>& lhs,
+                   const std::basic_string<CharT>& rhs ) noexcept;
+
+  template<typename CharT>
+  bool operator!=( const std::basic_string<CharT>& lhs,
+                   const basic_interned_string<CharT>& rhs ) noexcept;
+
+} // namespace serial
+
+#include "detail/StringPool.inl"
+
+#endif /* DATATRANSLATOR_STRINGPOOL_HPP_ */
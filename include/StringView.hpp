@@ -0,0 +1,189 @@
+/**
+ * \file StringView.hpp
+ *
+ * \brief This header contains non-owning views of strings that are borrowed
+ *        from the document being translated.
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ * \copyright Matthew Rodusek
+ */
+
+/*
+ * The MIT License (MIT)
+ *
+ * Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+ * Copyright (c) 2016 Matthew Rodusek <http://rodusek.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef DATATRANSLATOR_STRINGVIEW_HPP_
+#define DATATRANSLATOR_STRINGVIEW_HPP_
+
+#if __cplusplus < 201103L
+# error This file requires compiler and library support for the ISO C++11 standard.
+#endif
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace serial {
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \class serial::basic_string_view
+  ///
+  /// \brief A non-owning view of a contiguous sequence of characters
+  ///
+  /// String views are translated by borrowing the characters from the
+  /// document backing the translation scheme, rather than copying them into
+  /// an owning string. A translated view is only valid for as long as that
+  /// document is alive and unmodified; it is the caller's responsibility to
+  /// keep the document alive for as long as the translated object is used.
+  ///
+  /// Views convert implicitly from any contiguous string with \c data() and
+  /// \c size(), including \c std::basic_string and \c std::basic_string_view,
+  /// and explicitly to an owning \c std::basic_string.
+  ///
+  /// \tparam CharT the character type of the string
+  ////////////////////////////////////////////////////////////////////////////
+  template<typename CharT>
+  class basic_string_view
+  {
+    //------------------------------------------------------------------------
+    // Public Member Types
+    //------------------------------------------------------------------------
+  public:
+
+    typedef CharT        value_type;     ///< The character type of the string
+    typedef std::size_t  size_type;      ///< Size type
+    typedef const CharT* const_iterator; ///< Iterator over the characters
+    typedef const CharT* iterator;       ///< Iterator over the characters
+
+    //------------------------------------------------------------------------
+    // Constructors
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an empty view
+    constexpr basic_string_view() noexcept
+      : m_data(nullptr),
+        m_size(0)
+    {
+
+    }
+
+    /// \brief Views the \p size characters at \p str
+    ///
+    /// \param str  the characters to view
+    /// \param size the number of characters in \p str
+    constexpr basic_string_view( const CharT* str, size_type size ) noexcept
+      : m_data(str),
+        m_size(size)
+    {
+
+    }
+
+    /// \brief Views the null-terminated string \p str
+    ///
+    /// \param str the string to view
+    basic_string_view( const CharT* str ) noexcept
+      : m_data(str),
+        m_size(std::char_traits<CharT>::length(str))
+    {
+
+    }
+
+    /// \brief Views the characters of any contiguous string \p str
+    ///
+    /// \param str the string to view, which must outlive this view
+    template<typename StringT,
+             typename = typename std::enable_if<
+               !std::is_same<StringT,basic_string_view>::value &&
+               std::is_convertible<decltype(std::declval<const StringT&>().data()),const CharT*>::value
+             >::type>
+    basic_string_view( const StringT& str ) noexcept
+      : m_data(str.data()),
+        m_size(static_cast<size_type>(str.size()))
+    {
+
+    }
+
+    //------------------------------------------------------------------------
+    // Observers
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the characters of the view, which are not null-terminated
+    constexpr const CharT* data() const noexcept{ return m_data; }
+
+    /// \brief Gets the number of characters in the view
+    constexpr size_type size() const noexcept{ return m_size; }
+
+    /// \brief Checks whether the view has no characters
+    constexpr bool empty() const noexcept{ return m_size == 0; }
+
+    /// \brief Gets the character at \p pos, which must be less than size()
+    constexpr const CharT& operator[]( size_type pos ) const noexcept{ return m_data[pos]; }
+
+    constexpr const_iterator begin() const noexcept{ return m_data; }
+    constexpr const_iterator end() const noexcept{ return m_data + m_size; }
+
+    /// \brief Copies the characters of the view into an owning string
+    template<typename Traits, typename Allocator>
+    explicit operator std::basic_string<CharT,Traits,Allocator>() const
+    {
+      return std::basic_string<CharT,Traits,Allocator>( m_data, m_size );
+    }
+
+    //------------------------------------------------------------------------
+    // Comparison
+    //------------------------------------------------------------------------
+  public:
+
+    /// \brief Compares the characters of two views
+    friend bool operator==( basic_string_view lhs, basic_string_view rhs ) noexcept
+    {
+      return lhs.m_size == rhs.m_size &&
+             std::char_traits<CharT>::compare(lhs.m_data, rhs.m_data, lhs.m_size) == 0;
+    }
+
+    friend bool operator!=( basic_string_view lhs, basic_string_view rhs ) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+    //------------------------------------------------------------------------
+    // Private Members
+    //------------------------------------------------------------------------
+  private:
+
+    const CharT* m_data; ///< The viewed characters
+    size_type    m_size; ///< The number of viewed characters
+  };
+
+  typedef basic_string_view<char>     string_view;
+  typedef basic_string_view<wchar_t>  wstring_view;
+  typedef basic_string_view<char16_t> u16string_view;
+  typedef basic_string_view<char32_t> u32string_view;
+
+} // namespace serial
+
+#endif /* DATATRANSLATOR_STRINGVIEW_HPP_ */
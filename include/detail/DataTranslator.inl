@@ -9,24 +9,89 @@ namespace serial {
   // Verbose Loaders
   //--------------------------------------------------------------------------
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::size_type
-    DataTranslator<T,B,I,F,S,K>::members()
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::members()
     const noexcept
   {
-    return (m_bool_members.size()   + m_bool_vector_members.size() +
-            m_int_members.size()    + m_int_vector_members.size() +
-            m_float_members.size()  + m_float_vector_members.size() +
-            m_string_members.size() + m_string_vector_members.size());
+    return m_plan->members.size();
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline bool
+    DataTranslator<T,B,I,F,S,K,A>::frozen()
+    const noexcept
+  {
+    return m_plan->frozen;
+  }
+
+  //--------------------------------------------------------------------------
+  // Plan Compilation
+  //--------------------------------------------------------------------------
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::freeze()
+  {
+    if(m_plan->frozen) return (*this);
+
+    detach_plan();
+
+    // Group entries by kind so that dispatch in translate() stays predictable;
+    // keys order entries within a kind, matching the old per-kind map walk.
+    std::sort( m_plan->members.begin(), m_plan->members.end(),
+               [](const member_entry& lhs, const member_entry& rhs)
+    {
+      if(lhs.kind != rhs.kind) return lhs.kind < rhs.kind;
+      return lhs.key < rhs.key;
+    });
+    m_plan->members.shrink_to_fit();
+
+    build_key_index();
+    build_path_index();
+    m_prepared.clear();
+    m_plan->frozen = true;
+
+    return (*this);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename PreparingTranslationScheme>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::prepare( const PreparingTranslationScheme& data )
+  {
+    static_assert(concepts::ScalarTranslationScheme_prepare<PreparingTranslationScheme,K>::value,"prepare requires const function 'prepare(str)' to return a handle for the key");
+
+    typedef detail::prepared_key_t<PreparingTranslationScheme,K> prepared_key_type;
+
+    auto keys = std::make_shared<std::vector<prepared_key_type>>();
+    keys->reserve(m_plan->members.size());
+    for( auto const& entry : m_plan->members )
+    {
+      keys->push_back( data.prepare(entry.key) );
+    }
+
+    const void* scheme = detail::type_id<PreparingTranslationScheme>();
+    for( auto& prepared : m_prepared )
+    {
+      if(prepared.scheme == scheme)
+      {
+        prepared.keys = std::move(keys);
+        return (*this);
+      }
+    }
+    m_prepared.push_back( prepared_entry{ scheme, std::move(keys) } );
+
+    return (*this);
   }
 
   //--------------------------------------------------------------------------
   // Verbose Loaders
   //--------------------------------------------------------------------------
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_bool_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_bool_member( const key_string_type& name,
                                                   bool_member member )
   {
 #ifdef DEBUG
@@ -34,13 +99,13 @@ namespace serial {
       throw std::runtime_error("Duplicate member '" + name + "' added.");
     }
 #endif
-    m_bool_members[ name ] = member;
+    add_entry( name, detail::hash_key(name), member_kind::bool_scalar, offset_of(member) );
     return (*this);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_int_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_int_member( const key_string_type& name,
                                                  int_member member )
   {
 #ifdef DEBUG
@@ -48,13 +113,13 @@ namespace serial {
       throw std::runtime_error("Duplicate member '" + name + "' added.");
     }
 #endif
-    m_int_members[ name ] = member;
+    add_entry( name, detail::hash_key(name), member_kind::int_scalar, offset_of(member) );
     return (*this);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_float_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_float_member( const key_string_type& name,
                                                    float_member member )
   {
 #ifdef DEBUG
@@ -62,13 +127,13 @@ namespace serial {
       throw std::runtime_error("Duplicate member '" + name + "' added.");
     }
 #endif
-    m_float_members[ name ] = member;
+    add_entry( name, detail::hash_key(name), member_kind::float_scalar, offset_of(member) );
     return (*this);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_string_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_string_member( const key_string_type& name,
                                                     string_member member )
   {
 #ifdef DEBUG
@@ -76,15 +141,29 @@ namespace serial {
       throw std::runtime_error("Duplicate member '" + name + "' added.");
     }
 #endif
-    m_string_members[ name ] = member;
+    add_entry( name, detail::hash_key(name), member_kind::string_scalar, offset_of(member) );
+    return (*this);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_string_view_member( const key_string_type& name,
+                                                          string_view_member member )
+  {
+#ifdef DEBUG
+    if( has_member(name) ) {
+      throw std::runtime_error("Duplicate member '" + name + "' added.");
+    }
+#endif
+    add_entry( name, detail::hash_key(name), member_kind::string_view_scalar, offset_of(member) );
     return (*this);
   }
 
   //--------------------------------------------------------------------------
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_bool_vector_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_bool_vector_member( const key_string_type& name,
                                                          bool_vector_member member )
   {
 #ifdef DEBUG
@@ -92,13 +171,13 @@ namespace serial {
       throw std::runtime_error("Duplicate member '" + name + "' added.");
     }
 #endif
-    m_bool_vector_members[ name ] = member;
+    add_entry( name, detail::hash_key(name), member_kind::bool_vector, offset_of(member) );
     return (*this);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_int_vector_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_int_vector_member( const key_string_type& name,
                                                         int_vector_member member )
   {
 #ifdef DEBUG
@@ -106,13 +185,13 @@ namespace serial {
       throw std::runtime_error("Duplicate member '" + name + "' added.");
     }
 #endif
-    m_int_vector_members[ name ] = member;
+    add_entry( name, detail::hash_key(name), member_kind::int_vector, offset_of(member) );
     return (*this);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_float_vector_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_float_vector_member( const key_string_type& name,
                                                           float_vector_member member )
   {
 #ifdef DEBUG
@@ -120,13 +199,13 @@ namespace serial {
       throw std::runtime_error("Duplicate member '" + name + "' added.");
     }
 #endif
-    m_float_vector_members[ name ] = member;
+    add_entry( name, detail::hash_key(name), member_kind::float_vector, offset_of(member) );
     return (*this);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_string_vector_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_string_vector_member( const key_string_type& name,
                                                            string_vector_member member )
   {
 #ifdef DEBUG
@@ -134,7 +213,175 @@ namespace serial {
       throw std::runtime_error("Duplicate member '" + name + "' added.");
     }
 #endif
-    m_string_vector_members[ name ] = member;
+    add_entry( name, detail::hash_key(name), member_kind::string_vector, offset_of(member) );
+    return (*this);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_string_view_vector_member( const key_string_type& name,
+                                                                 string_view_vector_member member )
+  {
+#ifdef DEBUG
+    if( has_member(name) ) {
+      throw std::runtime_error("Duplicate member '" + name + "' added.");
+    }
+#endif
+    add_entry( name, detail::hash_key(name), member_kind::string_view_vector, offset_of(member) );
+    return (*this);
+  }
+
+  //--------------------------------------------------------------------------
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename U>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_struct_member( const key_string_type& name,
+                                                    U value_type::*member,
+                                                    const DataTranslator<U,B,I,F,S,K,A>& translator )
+  {
+    typedef typename key_string_type::value_type char_type;
+
+    const size_type base = offset_of(member);
+
+    // Compose the key and offset of each nested member with those of the
+    // structure, so that it is translated directly from this plan
+    for( const auto& entry : translator.m_plan->members )
+    {
+      key_string_type key = name;
+      key.push_back( char_type('.') );
+      key.append( entry.key.begin(), entry.key.end() );
+
+#ifdef DEBUG
+      if( has_member(key) ) {
+        throw std::runtime_error("Duplicate member '" + key + "' added.");
+      }
+#endif
+      member_entry nested = entry;
+      nested.hash   = detail::hash_key(key);
+      nested.offset = base + entry.offset;
+      nested.key    = std::move(key);
+
+      add_entry( std::move(nested) );
+    }
+    return (*this);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename U>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_struct_vector_member( const key_string_type& name,
+                                                           std::vector<U,A<U>> value_type::*member,
+                                                           const DataTranslator<U,B,I,F,S,K,A>& translator )
+  {
+    typedef std::vector<U,A<U>> vector_type;
+
+#ifdef DEBUG
+    if( has_member(name) ) {
+      throw std::runtime_error("Duplicate member '" + name + "' added.");
+    }
+#endif
+    auto elements = std::make_shared<detail::element_plan<key_string_type,string_type>>();
+    elements->members = translator.m_plan->members;
+    elements->stride  = sizeof(U);
+    elements->resize  = &detail::resize_elements<vector_type>;
+    elements->data    = &detail::element_data<vector_type>;
+    elements->size    = &detail::element_count<vector_type>;
+
+    // Translate the members of each element in the same order that a frozen
+    // plan would, so that each pass over the sequence reads a single kind
+    std::sort( elements->members.begin(), elements->members.end(),
+               [](const member_entry& lhs, const member_entry& rhs)
+    {
+      return (lhs.kind != rhs.kind) ? (lhs.kind < rhs.kind) : (lhs.key < rhs.key);
+    });
+
+    add_entry( member_entry{ name, detail::hash_key(name), offset_of(member), member_kind::struct_vector, 0, std::move(elements), nullptr, nullptr } );
+    return (*this);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename U, typename Converter>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_converted_member( const key_string_type& name,
+                                                       U value_type::*member,
+                                                       Converter converter )
+  {
+    typedef detail::converter_argument_t<Converter> source_type;
+
+    static_assert(kind_of<source_type>() < member_kind::converted_scalar,"add_converted_member requires a converter that takes a bool, int, float, string or string view type");
+
+#ifdef DEBUG
+    if( has_member(name) ) {
+      throw std::runtime_error("Duplicate member '" + name + "' added.");
+    }
+#endif
+    detail::member_converter functions = detail::member_converter();
+    functions.source = kind_of<source_type>();
+    functions.assign = &detail::assign_converted<Converter,source_type,U>;
+    functions.reset  = &detail::reset_converted<U>;
+
+    auto holder = std::make_shared<detail::converter_holder<Converter>>( functions, std::move(converter) );
+
+    add_entry( member_entry{ name, detail::hash_key(name), offset_of(member), member_kind::converted_scalar, 0, nullptr, std::move(holder), nullptr } );
+    return (*this);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename U, typename Converter>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_converted_vector_member( const key_string_type& name,
+                                                              std::vector<U,A<U>> value_type::*member,
+                                                              Converter converter )
+  {
+    typedef detail::converter_argument_t<Converter> source_type;
+    typedef std::vector<U,A<U>> vector_type;
+
+    static_assert(kind_of<source_type>() < member_kind::converted_scalar,"add_converted_vector_member requires a converter that takes a bool, int, float, string or string view type");
+
+#ifdef DEBUG
+    if( has_member(name) ) {
+      throw std::runtime_error("Duplicate member '" + name + "' added.");
+    }
+#endif
+    detail::member_converter functions = detail::member_converter();
+    functions.source   = kind_of<source_type>();
+    functions.write    = &detail::write_converted<Converter,source_type,vector_type>;
+    functions.reset    = &detail::reset_converted<vector_type>;
+    functions.reserve  = &detail::reserve_elements<vector_type>;
+    functions.truncate = &detail::truncate_elements<vector_type>;
+    functions.size     = &detail::element_count<vector_type>;
+
+    auto holder = std::make_shared<detail::converter_holder<Converter>>( functions, std::move(converter) );
+
+    add_entry( member_entry{ name, detail::hash_key(name), offset_of(member), member_kind::converted_vector, 0, nullptr, std::move(holder), nullptr } );
+    return (*this);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename E>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_enum_member( const key_string_type& name,
+                                                  E value_type::*member,
+                                                  std::initializer_list<std::pair<string_type,E>> values )
+  {
+    static_assert(std::is_enum<E>::value,"add_enum_member requires a member of an enum type");
+
+#ifdef DEBUG
+    if( has_member(name) ) {
+      throw std::runtime_error("Duplicate member '" + name + "' added.");
+    }
+#endif
+    std::vector<std::pair<string_type,std::int64_t>> mapping;
+    mapping.reserve(values.size());
+    for( const auto& value : values )
+    {
+      mapping.emplace_back( value.first, static_cast<std::int64_t>(value.second) );
+    }
+
+    auto enums = std::make_shared<detail::enum_table<string_type>>( std::move(mapping), &detail::assign_enum<E> );
+
+    add_entry( member_entry{ name, detail::hash_key(name), offset_of(member), member_kind::enum_scalar, 0, nullptr, nullptr, std::move(enums) } );
     return (*this);
   }
 
@@ -142,112 +389,198 @@ namespace serial {
   // Overloaded Member Loaders
   //--------------------------------------------------------------------------
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
                                              bool_member member )
   {
     return add_bool_member(name,member);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
                                              int_member member )
   {
     return add_int_member(name,member);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
                                              float_member member )
   {
     return add_float_member(name,member);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
                                              string_member member )
   {
     return add_string_member(name,member);
   }
 
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
+                                             string_view_member member )
+  {
+    return add_string_view_member(name,member);
+  }
+
   //--------------------------------------------------------------------------
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
                                              bool_vector_member member )
   {
     return add_bool_vector_member(name,member);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
                                              int_vector_member member )
   {
     return add_int_vector_member(name,member);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
                                              float_vector_member member )
   {
     return add_float_vector_member(name,member);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  inline typename DataTranslator<T,B,I,F,S,K>::this_type&
-    DataTranslator<T,B,I,F,S,K>::add_member( const key_string_type& name,
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
                                              string_vector_member member )
   {
     return add_string_vector_member(name,member);
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
+                                             string_view_vector_member member )
+  {
+    return add_string_view_vector_member(name,member);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename U>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const hashed_key_type& name,
+                                             U value_type::*member )
+  {
+    static_assert(kind_of<U>() != member_kind(-1),"add_member requires a member of a translated type, or a vector of one");
+
+    const key_string_type key( name.data(), name.size() );
+#ifdef DEBUG
+    if( has_member(key) ) {
+      throw std::runtime_error("Duplicate member '" + key + "' added.");
+    }
+#endif
+    add_entry( key, name.hash(), kind_of<U>(), offset_of(member) );
+    return (*this);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename U>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
+                                             U value_type::*member,
+                                             const DataTranslator<U,B,I,F,S,K,A>& translator )
+  {
+    return add_struct_member(name,member,translator);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename U>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
+                                             std::vector<U,A<U>> value_type::*member,
+                                             const DataTranslator<U,B,I,F,S,K,A>& translator )
+  {
+    return add_struct_vector_member(name,member,translator);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename U, typename Converter>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
+                                             U value_type::*member,
+                                             Converter converter )
+  {
+    return add_converted_member(name,member,std::move(converter));
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename U, typename Converter>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::this_type&
+    DataTranslator<T,B,I,F,S,K,A>::add_member( const key_string_type& name,
+                                             std::vector<U,A<U>> value_type::*member,
+                                             Converter converter )
+  {
+    return add_converted_vector_member(name,member,std::move(converter));
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename Key>
   inline bool
-    DataTranslator<T,B,I,F,S,K>::has_member( const key_string_type& name )
+    DataTranslator<T,B,I,F,S,K,A>::has_member( const Key& name )
+    const
   {
-    return m_bool_members.find(name)!=m_bool_members.end() ||
-           m_int_members.find(name)!=m_int_members.end() ||
-           m_float_members.find(name)!=m_float_members.end() ||
-           m_string_members.find(name)!=m_string_members.end() ||
-           m_bool_vector_members.find(name)!=m_bool_vector_members.end() ||
-           m_int_vector_members.find(name)!=m_int_vector_members.end() ||
-           m_float_vector_members.find(name)!=m_float_vector_members.end() ||
-           m_string_vector_members.find(name)!=m_string_vector_members.end();
+    if(m_plan->frozen)
+    {
+      const auto range = find_key(name);
+      return range.first != range.second;
+    }
+
+    for( auto const& entry : m_plan->members )
+    {
+      if(detail::key_equal(entry.key, name)) return true;
+    }
+    return false;
   }
 
   //--------------------------------------------------------------------------
   // Overloaded Member Loaders
   //--------------------------------------------------------------------------
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
   template<typename ScalarTranslationScheme>
-  typename DataTranslator<T,B,I,F,S,K>::size_type
-    DataTranslator<T,B,I,F,S,K>::translate( value_type* object,
-                                            const ScalarTranslationScheme& data )
+  typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate( value_type* object,
+                                            const ScalarTranslationScheme& data,
+                                            translate_mode mode )
     const
   {
     constexpr concepts::ScalarTranslationScheme<ScalarTranslationScheme,B,I,F,S,K> validation;
     (void) validation;
 
-    size_type count = 0;
-
-    count += translate_scalar_data(object,data);
-    count += translate_vector_data(object,data);
+    return translate_keys( object, data, mode, concepts::ScalarTranslationScheme_child<ScalarTranslationScheme,K>() );
+  }
 
-    return count;
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline void
+    DataTranslator<T,B,I,F,S,K,A>::reset( value_type* object )
+    const
+  {
+    for( const auto& entry : m_plan->members )
+    {
+      reset_member( object, entry );
+    }
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
   template<typename ScalarTranslationScheme>
-  typename DataTranslator<T,B,I,F,S,K>::size_type
-    DataTranslator<T,B,I,F,S,K>::translate_uniform( value_type* objects,
+  typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_uniform( value_type* objects,
                                                     size_type size,
                                                     const ScalarTranslationScheme& data )
     const
@@ -255,45 +588,83 @@ namespace serial {
     constexpr concepts::ScalarTranslationScheme<ScalarTranslationScheme,B,I,F,S,K> validation;
     (void) validation;
 
-    if(size==0) return 0;
+    return detail::translate_uniform( *this, objects, size, data );
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename ScalarTranslationScheme>
+  typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_batch( value_type* objects,
+                                                  const ScalarTranslationScheme* schemes,
+                                                  size_type size,
+                                                  translate_mode mode )
+    const
+  {
+    constexpr concepts::ScalarTranslationScheme<ScalarTranslationScheme,B,I,F,S,K> validation;
+    (void) validation;
 
-    // Translate the first object
-    size_type result = translate( &objects[0], data );
+    if(size == 0) return 0;
 
-    // Since objects are guaranteed to be linearly arranged, memcpy all after
-    // the first one is created.
-    if(size > 1 )
+    const auto* keys = prepared_keys( schemes[0], concepts::ScalarTranslationScheme_prepare<ScalarTranslationScheme,K>() );
+    if(keys)
     {
-      std::memcpy( &objects[1], &objects[0], (size - 1) * sizeof(value_type) );
+      return translate_plan_batch( objects, schemes, size, mode, [&](size_type i) -> decltype(*keys->data())
+      {
+        return (*keys)[i];
+      });
     }
-    return result;
+    typedef concepts::ScalarTranslationScheme_has<ScalarTranslationScheme,hashed_key_type> is_hashing;
+    typedef decltype(scheme_key(std::declval<const K&>(),nullptr,0,is_hashing())) scheme_key_type;
 
+    return translate_plan_batch( objects, schemes, size, mode, [&](size_type i) -> scheme_key_type
+    {
+      return scheme_key( m_plan->members[i].key, key_chars(m_plan->members[i]), m_plan->members[i].hash, is_hashing() );
+    });
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
   template<typename OutputIterator, typename SequenceTranslationScheme>
-  typename DataTranslator<T,B,I,F,S,K>::size_type
-    DataTranslator<T,B,I,F,S,K>::translate_sequence( OutputIterator it,
+  typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_sequence( OutputIterator it,
                                                      SequenceTranslationScheme& data )
     const
   {
     constexpr concepts::SequenceTranslationScheme<SequenceTranslationScheme,B,I,F,S,K> validation;
     (void) validation;
 
-    size_type entries = 0;
-    do{
-      value_type value;
-      entries += translate( &value, data );
-      (*it) = std::move(value);
-      ++it;
-    } while( data.next() );
-    return entries;
+    return detail::translate_sequence( *this, it, data );
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
   template<typename OutputIterator, typename SequenceTranslationScheme>
-  typename DataTranslator<T,B,I,F,S,K>::size_type
-    DataTranslator<T,B,I,F,S,K>::translate_sequence( OutputIterator it,
+  typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_sequence( OutputIterator it,
+                                                     SequenceTranslationScheme& data,
+                                                     monotonic_arena& arena )
+    const
+  {
+    arena_scope scope(arena);
+
+    return translate_sequence( it, data );
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename Container, typename SequenceTranslationScheme>
+  typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_sequence_into( Container& objects,
+                                                          SequenceTranslationScheme& data )
+    const
+  {
+    constexpr concepts::SequenceTranslationScheme<SequenceTranslationScheme,B,I,F,S,K> validation;
+    (void) validation;
+
+    return detail::translate_sequence_into( *this, objects, data );
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename OutputIterator, typename SequenceTranslationScheme>
+  typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_sequence( OutputIterator it,
                                                      size_type size,
                                                      SequenceTranslationScheme& data )
     const
@@ -301,146 +672,850 @@ namespace serial {
     constexpr concepts::SequenceTranslationScheme<SequenceTranslationScheme,B,I,F,S,K> validation;
     (void) validation;
 
-    size_type count   = 0;
-    size_type entries = 0;
-    do{
-      value_type value;
-      entries += translate( &value, data );
-      (*it) = std::move(value);
-      ++it;
-      ++count;
-    } while( data.next() && count < size );
-    return entries;
+    return detail::translate_sequence( *this, it, size, data );
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename PullTranslationScheme>
+  typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_pull( value_type* object,
+                                                 const PullTranslationScheme& data,
+                                                 translate_mode mode )
+    const
+  {
+    constexpr concepts::PullTranslationScheme<PullTranslationScheme,B,I,F,S,K> validation;
+    (void) validation;
+
+    size_type count = 0;
+
+    data.for_each_key( pull_key<PullTranslationScheme>{ this, object, &data, mode, &count } );
+
+    return count;
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename RandomAccessIterator, typename RandomAccessSequenceTranslationScheme>
+  typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_sequence_parallel( RandomAccessIterator it,
+                                                              const RandomAccessSequenceTranslationScheme& data,
+                                                              size_type threads )
+    const
+  {
+    constexpr concepts::RandomAccessSequenceTranslationScheme<RandomAccessSequenceTranslationScheme,B,I,F,S,K> validation;
+    (void) validation;
+
+    return detail::translate_sequence_parallel( *this, it, data, threads );
   }
 
   //--------------------------------------------------------------------------
-  // Translate Members
+  // Private Member Functions
   //--------------------------------------------------------------------------
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
-  template<typename TranslationScheme>
-  typename DataTranslator<T,B,I,F,S,K>::size_type
-    DataTranslator<T,B,I,F,S,K>::translate_scalar_data( value_type* object,
-                                                        const TranslationScheme& data )
-    const
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::plan_type&
+    DataTranslator<T,B,I,F,S,K,A>::detach_plan()
   {
-    size_type count = 0;
+    if(m_plan.use_count() != 1)
+    {
+      m_plan = std::make_shared<plan_type>(*m_plan);
+    }
+    return *m_plan;
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline void
+    DataTranslator<T,B,I,F,S,K,A>::add_entry( const key_string_type& name,
+                                            std::uint64_t hash,
+                                            member_kind kind,
+                                            size_type offset )
+  {
+    add_entry( member_entry{ name, hash, offset, kind, 0, nullptr, nullptr, nullptr } );
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline void
+    DataTranslator<T,B,I,F,S,K,A>::add_entry( member_entry entry )
+  {
+    detach_plan();
+
+    m_plan->frozen = false;
+    m_prepared.clear();
+
+    for( auto& existing : m_plan->members )
+    {
+      if(existing.kind == entry.kind && existing.key == entry.key)
+      {
+        existing = std::move(entry);
+        return;
+      }
+    }
+    m_plan->members.push_back( std::move(entry) );
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename U>
+  inline constexpr member_kind
+    DataTranslator<T,B,I,F,S,K,A>::kind_of()
+    noexcept
+  {
+    return std::is_same<U,bool_type>::value                 ? member_kind::bool_scalar :
+           std::is_same<U,int_type>::value                  ? member_kind::int_scalar :
+           std::is_same<U,float_type>::value                ? member_kind::float_scalar :
+           std::is_same<U,string_type>::value               ? member_kind::string_scalar :
+           std::is_same<U,string_view_type>::value          ? member_kind::string_view_scalar :
+           std::is_same<U,bool_vector_type>::value    ? member_kind::bool_vector :
+           std::is_same<U,int_vector_type>::value     ? member_kind::int_vector :
+           std::is_same<U,float_vector_type>::value   ? member_kind::float_vector :
+           std::is_same<U,string_vector_type>::value  ? member_kind::string_vector :
+           std::is_same<U,string_view_vector_type>::value ? member_kind::string_view_vector :
+                                                              member_kind(-1);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline const typename DataTranslator<T,B,I,F,S,K,A>::hashed_key_type::value_type*
+    DataTranslator<T,B,I,F,S,K,A>::key_chars( const member_entry& entry )
+    const noexcept
+  {
+    if(m_plan->frozen) return m_plan->key_table.data(entry.key_offset);
+    return entry.key.data();
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::hashed_key_type
+    DataTranslator<T,B,I,F,S,K,A>::scheme_key( const key_string_type& key,
+                                             const typename hashed_key_type::value_type* chars,
+                                             std::uint64_t hash,
+                                             std::true_type )
+    noexcept
+  {
+    return hashed_key_type( chars, key.size(), hash );
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline const typename DataTranslator<T,B,I,F,S,K,A>::key_string_type&
+    DataTranslator<T,B,I,F,S,K,A>::scheme_key( const key_string_type& key,
+                                             const typename hashed_key_type::value_type*,
+                                             std::uint64_t,
+                                             std::false_type )
+    noexcept
+  {
+    return key;
+  }
 
-    for( auto const& pair : m_bool_members )
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline void
+    DataTranslator<T,B,I,F,S,K,A>::build_key_index()
+  {
+    // Group the plan entries by key; one key may name members of several
+    // kinds
+    m_plan->key_entries.resize(m_plan->members.size());
+    for( size_type i = 0; i < m_plan->members.size(); ++i )
+    {
+      m_plan->key_entries[i] = i;
+    }
+    std::stable_sort( m_plan->key_entries.begin(), m_plan->key_entries.end(),
+                      [&](size_type lhs, size_type rhs)
     {
-      const bool_member ptr = pair.second;
+      return m_plan->members[lhs].key < m_plan->members[rhs].key;
+    });
 
-      if(data.has(pair.first))
+    // Each distinct key is interned once into the key table, which is all
+    // that lookups touch
+    m_plan->key_table.clear();
+
+    std::vector<key_group>              groups;
+    std::vector<const key_string_type*> keys;
+    for( size_type i = 0; i < m_plan->key_entries.size(); ++i )
+    {
+      auto& entry = m_plan->members[m_plan->key_entries[i]];
+      if(keys.empty() || !(*keys.back() == entry.key))
       {
-        ++count;
-        (*object).*ptr = data.as_bool(pair.first);
+        const auto offset = m_plan->key_table.add( entry.key.data(), entry.key.size() );
+        groups.push_back( key_group{ i, 0, offset, entry.key.size() } );
+        keys.push_back( &entry.key );
       }
+      entry.key_offset = groups.back().key_offset;
+      ++groups.back().count;
     }
+    m_plan->key_table.shrink_to_fit();
 
-    for( auto const& pair : m_int_members )
+    const auto slots = m_plan->key_hash.build(keys);
+
+    m_plan->key_groups.resize(groups.size());
+    for( size_type i = 0; i < groups.size(); ++i )
     {
-      const int_member ptr = pair.second;
+      m_plan->key_groups[slots[i]] = groups[i];
+    }
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline void
+    DataTranslator<T,B,I,F,S,K,A>::build_path_index()
+  {
+    typedef typename key_string_type::value_type char_type;
 
-      if(data.has(pair.first))
+    const char_type separator = char_type('.');
+
+    std::vector<std::vector<key_string_type>> segments(m_plan->members.size());
+    std::vector<size_type>                    entries(m_plan->members.size());
+    for( size_type i = 0; i < m_plan->members.size(); ++i )
+    {
+      const auto& key = m_plan->members[i].key;
+
+      size_type first = 0;
+      size_type last  = key.find(separator);
+      while(last != key_string_type::npos)
       {
-        ++count;
-        (*object).*ptr = data.as_int(pair.first);
+        segments[i].push_back( key.substr(first, last - first) );
+        first = last + 1;
+        last  = key.find(separator, first);
       }
+      segments[i].push_back( key.substr(first) );
+      entries[i] = i;
     }
 
-    for( auto const& pair : m_float_members )
+    m_plan->path_nodes.clear();
+    m_plan->path_leaves.clear();
+    m_plan->path_nodes.push_back( path_node{ key_string_type(), 0, 0, 0, 0 } );
+    build_path_node( 0, 0, entries, segments );
+
+    m_plan->path_nodes.shrink_to_fit();
+    m_plan->path_leaves.shrink_to_fit();
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline void
+    DataTranslator<T,B,I,F,S,K,A>::build_path_node( size_type node,
+                                                  size_type depth,
+                                                  const std::vector<size_type>& entries,
+                                                  const std::vector<std::vector<key_string_type>>& segments )
+  {
+    // Members whose key ends at this depth are leaves of the node; the rest
+    // are grouped into children by their next segment, preserving plan order
+    std::vector<key_string_type>        children;
+    std::vector<std::vector<size_type>> child_entries;
+
+    m_plan->path_nodes[node].first_leaf = m_plan->path_leaves.size();
+    for( auto entry : entries )
     {
-      const float_member ptr = pair.second;
+      const auto& segment = segments[entry][depth];
+      if(segments[entry].size() == depth + 1)
+      {
+        m_plan->path_leaves.push_back( path_leaf{ segment, detail::hash_key(segment), entry } );
+        continue;
+      }
 
-      if(data.has(pair.first))
+      const auto it = std::find( children.begin(), children.end(), segment );
+      if(it == children.end())
       {
-        ++count;
-        (*object).*ptr = data.as_float(pair.first);
+        children.push_back( segment );
+        child_entries.push_back( std::vector<size_type>(1, entry) );
       }
+      else
+      {
+        child_entries[it - children.begin()].push_back( entry );
+      }
+    }
+    m_plan->path_nodes[node].leaf_count = m_plan->path_leaves.size() - m_plan->path_nodes[node].first_leaf;
+
+    // Allocate the children contiguously before building any of them
+    const size_type first_child = m_plan->path_nodes.size();
+    m_plan->path_nodes[node].first_child = first_child;
+    m_plan->path_nodes[node].child_count = children.size();
+    for( auto& segment : children )
+    {
+      m_plan->path_nodes.push_back( path_node{ std::move(segment), 0, 0, 0, 0 } );
     }
 
-    for( auto const& pair : m_string_members )
+    for( size_type i = 0; i < child_entries.size(); ++i )
     {
-      const string_member ptr = pair.second;
+      build_path_node( first_child + i, depth + 1, child_entries[i], segments );
+    }
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename Key>
+  inline std::pair<const typename DataTranslator<T,B,I,F,S,K,A>::size_type*,
+                   const typename DataTranslator<T,B,I,F,S,K,A>::size_type*>
+    DataTranslator<T,B,I,F,S,K,A>::find_key( const Key& name )
+    const noexcept
+  {
+    if(m_plan->key_groups.empty()) return { nullptr, nullptr };
 
-      if(data.has(pair.first))
+    // A single comparison confirms whether the key is in the set
+    const auto& group = m_plan->key_groups[m_plan->key_hash.slot(name)];
+    if(!m_plan->key_table.equal(group.key_offset, group.key_size, name)) return { nullptr, nullptr };
+
+    const auto* first = m_plan->key_entries.data() + group.first;
+
+    return { first, first + group.count };
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme, typename Key>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_key( value_type* object,
+                                                const Key& name,
+                                                const TranslationScheme& data,
+                                                translate_mode mode )
+    const
+  {
+    size_type count = 0;
+
+    if(m_plan->frozen)
+    {
+      const auto range = find_key(name);
+      for( auto it = range.first; it != range.second; ++it )
+      {
+        count += translate_member(object,m_plan->members[*it],name,data,mode);
+      }
+    }
+    else
+    {
+      for( auto const& entry : m_plan->members )
       {
-        ++count;
-        (*object).*ptr = data.as_string(pair.first);
+        if(detail::key_equal(entry.key, name)) count += translate_member(object,entry,name,data,mode);
       }
     }
     return count;
   }
 
-  template<typename T, typename B, typename I, typename F, typename S, typename K>
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
   template<typename TranslationScheme>
-  typename DataTranslator<T,B,I,F,S,K>::size_type
-    DataTranslator<T,B,I,F,S,K>::translate_vector_data( value_type* object,
-                                                        const TranslationScheme& data )
+  inline const std::vector<detail::prepared_key_t<TranslationScheme,K>>*
+    DataTranslator<T,B,I,F,S,K,A>::prepared_keys( const TranslationScheme&,
+                                                std::true_type )
+    const noexcept
+  {
+    typedef std::vector<detail::prepared_key_t<TranslationScheme,K>> prepared_vector;
+
+    const void* scheme = detail::type_id<TranslationScheme>();
+    for( auto const& prepared : m_prepared )
+    {
+      if(prepared.scheme == scheme)
+      {
+        return static_cast<const prepared_vector*>(prepared.keys.get());
+      }
+    }
+    return nullptr;
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme>
+  inline const std::vector<K>*
+    DataTranslator<T,B,I,F,S,K,A>::prepared_keys( const TranslationScheme&,
+                                                std::false_type )
+    const noexcept
+  {
+    return nullptr;
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_keys( value_type* object,
+                                                 const TranslationScheme& data,
+                                                 translate_mode mode,
+                                                 std::true_type )
+    const
+  {
+    if(!m_plan->frozen) return translate_keys( object, data, mode, std::false_type() );
+
+    return translate_path( object, m_plan->path_nodes.front(), data, mode );
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_keys( value_type* object,
+                                                 const TranslationScheme& data,
+                                                 translate_mode mode,
+                                                 std::false_type )
+    const
+  {
+    const auto* keys = prepared_keys( data, concepts::ScalarTranslationScheme_prepare<TranslationScheme,K>() );
+    if(keys)
+    {
+      return translate_plan( object, data, mode, [&](size_type i) -> decltype(*keys->data())
+      {
+        return (*keys)[i];
+      });
+    }
+    typedef concepts::ScalarTranslationScheme_has<TranslationScheme,hashed_key_type> is_hashing;
+    typedef decltype(scheme_key(std::declval<const K&>(),nullptr,0,is_hashing())) scheme_key_type;
+
+    return translate_plan( object, data, mode, [&](size_type i) -> scheme_key_type
+    {
+      return scheme_key( m_plan->members[i].key, key_chars(m_plan->members[i]), m_plan->members[i].hash, is_hashing() );
+    });
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_path( value_type* object,
+                                                 const path_node& node,
+                                                 const TranslationScheme& data,
+                                                 translate_mode mode )
+    const
+  {
+    typedef detail::child_scheme_t<TranslationScheme,K> child_scheme;
+
+    constexpr concepts::ScalarTranslationScheme<child_scheme,B,I,F,S,K> validation;
+    (void) validation;
+    static_assert(concepts::ScalarTranslationScheme_child<child_scheme,K>::value,"The scheme returned by 'child(str)' must itself provide const function 'child(str)'");
+
+    typedef concepts::ScalarTranslationScheme_has<TranslationScheme,hashed_key_type> is_hashing;
+
+    size_type count = 0;
+
+    const auto* leaf = m_plan->path_leaves.data() + node.first_leaf;
+    for( size_type i = 0; i < node.leaf_count; ++i, ++leaf )
+    {
+      // The segment is the tail of the entry's key in the key table
+      const auto& entry = m_plan->members[leaf->entry];
+      const auto* chars = m_plan->key_table.data(entry.key_offset + entry.key.size() - leaf->segment.size());
+
+      count += translate_member(object,entry,scheme_key(leaf->segment,chars,leaf->hash,is_hashing()),data,mode);
+    }
+
+    const auto* child = m_plan->path_nodes.data() + node.first_child;
+    for( size_type i = 0; i < node.child_count; ++i, ++child )
+    {
+      count += translate_path(object,*child,data.child(child->segment),mode);
+    }
+
+    return count;
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme, typename KeyOf>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_plan( value_type* object,
+                                                 const TranslationScheme& data,
+                                                 translate_mode mode,
+                                                 KeyOf key_of )
+    const
+  {
+    size_type count = 0;
+
+    for( size_type i = 0; i < m_plan->members.size(); ++i )
+    {
+      count += translate_member(object,m_plan->members[i],key_of(i),data,mode);
+    }
+
+    return count;
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme, typename KeyOf>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::translate_plan_batch( value_type* objects,
+                                                       const TranslationScheme* schemes,
+                                                       size_type size,
+                                                       translate_mode mode,
+                                                       KeyOf key_of )
     const
   {
     size_type count = 0;
 
-    for( auto const& pair : m_bool_vector_members )
+    for( size_type e = 0; e < m_plan->members.size(); ++e )
     {
-      const bool_vector_member ptr = pair.second;
+      const auto& entry = m_plan->members[e];
+      const auto& key   = key_of(e);
 
-      if(data.has(pair.first))
+      for( size_type i = 0; i < size; ++i )
       {
-        ++count;
-        ((*object).*ptr).reserve(data.size(pair.first));
-        data.template as_bool_sequence(pair.first, [&](const bool_type& value)
+        if(i + detail::prefetch_distance < size)
         {
-          ((*object).*ptr).push_back(value);
-        });
+          detail::prefetch_write( &objects[i + detail::prefetch_distance] );
+          detail::prefetch_read( &schemes[i + detail::prefetch_distance] );
+        }
+
+        count += translate_member(&objects[i],entry,key,schemes[i],mode);
       }
     }
 
-    for( auto const& pair : m_int_vector_members )
+    return count;
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme, typename Key>
+  inline bool
+    DataTranslator<T,B,I,F,S,K,A>::translate_member( value_type* object,
+                                                   const member_entry& entry,
+                                                   const Key& key,
+                                                   const TranslationScheme& data,
+                                                   translate_mode mode )
+    const
+  {
+    if(entry.kind < member_kind::bool_vector)
+    {
+      return translate_scalar_data(object,entry,key,data);
+    }
+    return translate_vector_data(object,entry,key,data,mode);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme, typename Key>
+  inline bool
+    DataTranslator<T,B,I,F,S,K,A>::translate_scalar_data( value_type* object,
+                                                        const member_entry& entry,
+                                                        const Key& key,
+                                                        const TranslationScheme& data )
+    const
+  {
+    switch(entry.kind)
+    {
+    case member_kind::bool_scalar:
+      return detail::read_bool( data, key, member_at<bool_type>(object,entry.offset) );
+    case member_kind::int_scalar:
+      return detail::read_int( data, key, member_at<int_type>(object,entry.offset) );
+    case member_kind::float_scalar:
+      return detail::read_float( data, key, member_at<float_type>(object,entry.offset) );
+    case member_kind::string_scalar:
+      return detail::read_string( data, key, member_at<string_type>(object,entry.offset) );
+    case member_kind::string_view_scalar:
+      return detail::read_string_view( data, key, member_at<string_view_type>(object,entry.offset) );
+    case member_kind::converted_scalar:
+      return translate_converted_scalar( object, entry, key, data );
+    case member_kind::enum_scalar:
+      return translate_enum_data( object, entry, key, data, concepts::ScalarTranslationScheme_as_string_view<TranslationScheme,string_view_type,Key>() );
+    default:
+      return false;
+    }
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme, typename Key>
+  inline bool
+    DataTranslator<T,B,I,F,S,K,A>::translate_vector_data( value_type* object,
+                                                        const member_entry& entry,
+                                                        const Key& key,
+                                                        const TranslationScheme& data,
+                                                        translate_mode mode )
+    const
+  {
+    const bool replace = (mode == translate_mode::replace);
+
+    switch(entry.kind)
+    {
+    case member_kind::bool_vector:
+      return detail::read_bool_sequence( data, key, member_at<bool_vector_type>(object,entry.offset), replace );
+    case member_kind::int_vector:
+      return detail::read_int_sequence( data, key, member_at<int_vector_type>(object,entry.offset), replace );
+    case member_kind::float_vector:
+      return detail::read_float_sequence( data, key, member_at<float_vector_type>(object,entry.offset), replace );
+    case member_kind::string_vector:
+      return detail::read_string_sequence( data, key, member_at<string_vector_type>(object,entry.offset), replace );
+    case member_kind::string_view_vector:
+      return detail::read_string_view_sequence( data, key, member_at<string_view_vector_type>(object,entry.offset), replace );
+    case member_kind::struct_vector:
+      return translate_element_data( object, entry, key, data, mode, concepts::ScalarTranslationScheme_as_sequence<TranslationScheme,Key>() );
+    case member_kind::converted_vector:
+      return translate_converted_vector( object, entry, key, data, mode );
+    default:
+      return false;
+    }
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme, typename Key>
+  inline bool
+    DataTranslator<T,B,I,F,S,K,A>::translate_element_data( value_type* object,
+                                                         const member_entry& entry,
+                                                         const Key& key,
+                                                         const TranslationScheme& data,
+                                                         translate_mode mode,
+                                                         std::true_type )
+    const
+  {
+    if(!data.has(key)) return false;
+
+    const auto  sequence = data.as_sequence(key);
+    const auto& elements = *entry.elements;
+
+    typedef typename std::decay<decltype(sequence.at(0))>::type element_scheme;
+    typedef concepts::ScalarTranslationScheme_has<element_scheme,hashed_key_type> is_hashing;
+
+    void* const vector = static_cast<void*>(&member_at<unsigned char>(object,entry.offset));
+
+    const size_type count = sequence.count();
+    const size_type first = (mode == translate_mode::replace) ? 0 : elements.size(vector);
+
+    // Reused elements are reset, and new elements are constructed in place
+    // by a single resize
+    if(mode == translate_mode::replace)
     {
-      const int_vector_member ptr = pair.second;
+      char* const bytes = static_cast<char*>(elements.data(vector));
+      const size_type reused = std::min(elements.size(vector),count);
 
-      if(data.has(pair.first))
+      for( const auto& e : elements.members )
       {
-        ++count;
-        ((*object).*ptr).reserve(data.size(pair.first));
-        data.template as_int_sequence(pair.first, [&](const int_type& value)
+        for( size_type i = 0; i < reused; ++i )
         {
-          ((*object).*ptr).push_back(value);
-        });
+          reset_member( static_cast<value_type*>(static_cast<void*>(bytes + i * elements.stride)), e );
+        }
       }
     }
+    elements.resize(vector, first + count);
 
-    for( auto const& pair : m_float_vector_members )
+    char* const bytes = static_cast<char*>(elements.data(vector)) + first * elements.stride;
+
+    // Translate one member across the whole sequence at a time, so that
+    // each pass dispatches on a single kind and key
+    for( const auto& e : elements.members )
     {
-      const float_vector_member ptr = pair.second;
+      const auto& element_key = scheme_key( e.key, e.key.data(), e.hash, is_hashing() );
 
-      if(data.has(pair.first))
+      for( size_type i = 0; i < count; ++i )
       {
-        ++count;
-        ((*object).*ptr).reserve(data.size(pair.first));
-        data.template as_float_sequence(pair.first, [&](const float_type& value)
-        {
-          ((*object).*ptr).push_back(value);
-        });
+        translate_member( static_cast<value_type*>(static_cast<void*>(bytes + i * elements.stride)), e, element_key, sequence.at(i), mode );
       }
     }
+    return true;
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme, typename Key>
+  inline bool
+    DataTranslator<T,B,I,F,S,K,A>::translate_element_data( value_type*,
+                                                         const member_entry&,
+                                                         const Key&,
+                                                         const TranslationScheme&,
+                                                         translate_mode,
+                                                         std::false_type )
+    const
+  {
+    return false;
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  inline void
+    DataTranslator<T,B,I,F,S,K,A>::reset_member( value_type* object,
+                                               const member_entry& entry )
+  {
+    switch(entry.kind)
+    {
+    case member_kind::bool_scalar:
+      return detail::reset_member( member_at<bool_type>(object,entry.offset) );
+    case member_kind::int_scalar:
+      return detail::reset_member( member_at<int_type>(object,entry.offset) );
+    case member_kind::float_scalar:
+      return detail::reset_member( member_at<float_type>(object,entry.offset) );
+    case member_kind::string_scalar:
+      return detail::reset_member( member_at<string_type>(object,entry.offset) );
+    case member_kind::string_view_scalar:
+      return detail::reset_member( member_at<string_view_type>(object,entry.offset) );
+    case member_kind::bool_vector:
+      return detail::reset_member( member_at<bool_vector_type>(object,entry.offset) );
+    case member_kind::int_vector:
+      return detail::reset_member( member_at<int_vector_type>(object,entry.offset) );
+    case member_kind::float_vector:
+      return detail::reset_member( member_at<float_vector_type>(object,entry.offset) );
+    case member_kind::string_vector:
+      return detail::reset_member( member_at<string_vector_type>(object,entry.offset) );
+    case member_kind::string_view_vector:
+      return detail::reset_member( member_at<string_view_vector_type>(object,entry.offset) );
+    case member_kind::struct_vector:
+      return entry.elements->resize( &member_at<unsigned char>(object,entry.offset), 0 );
+    case member_kind::converted_scalar:
+    case member_kind::converted_vector:
+      return entry.converter->reset( &member_at<unsigned char>(object,entry.offset) );
+    case member_kind::enum_scalar:
+      return entry.enums->assign( &member_at<unsigned char>(object,entry.offset), 0 );
+    }
+  }
 
-    for( auto const& pair : m_string_vector_members )
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme, typename Key>
+  inline bool
+    DataTranslator<T,B,I,F,S,K,A>::translate_enum_data( value_type* object,
+                                                      const member_entry& entry,
+                                                      const Key& key,
+                                                      const TranslationScheme& data,
+                                                      std::true_type )
+    const
+  {
+    // The name is borrowed from the scheme, so no string is allocated
+    string_view_type text;
+    std::int64_t     value = 0;
+
+    if(!detail::read_string_view( data, key, text )) return false;
+    if(!entry.enums->find( text, value )) return false;
+
+    entry.enums->assign( &member_at<unsigned char>(object,entry.offset), value );
+    return true;
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme, typename Key>
+  inline bool
+    DataTranslator<T,B,I,F,S,K,A>::translate_enum_data( value_type* object,
+                                                      const member_entry& entry,
+                                                      const Key& key,
+                                                      const TranslationScheme& data,
+                                                      std::false_type )
+    const
+  {
+    string_type  text;
+    std::int64_t value = 0;
+
+    if(!detail::read_string( data, key, text )) return false;
+    if(!entry.enums->find( text, value )) return false;
+
+    entry.enums->assign( &member_at<unsigned char>(object,entry.offset), value );
+    return true;
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme, typename Key>
+  inline bool
+    DataTranslator<T,B,I,F,S,K,A>::translate_converted_scalar( value_type* object,
+                                                             const member_entry& entry,
+                                                             const Key& key,
+                                                             const TranslationScheme& data )
+    const
+  {
+    const auto& converter = *entry.converter;
+    void* const member    = &member_at<unsigned char>(object,entry.offset);
+
+    // The value is read into its source type on the stack, and converted
+    // straight into the member
+    switch(converter.source)
+    {
+    case member_kind::bool_scalar:
+    {
+      bool_type value = bool_type();
+      if(!detail::read_bool( data, key, value )) return false;
+      converter.assign( converter, &value, member );
+      return true;
+    }
+    case member_kind::int_scalar:
+    {
+      int_type value = int_type();
+      if(!detail::read_int( data, key, value )) return false;
+      converter.assign( converter, &value, member );
+      return true;
+    }
+    case member_kind::float_scalar:
+    {
+      float_type value = float_type();
+      if(!detail::read_float( data, key, value )) return false;
+      converter.assign( converter, &value, member );
+      return true;
+    }
+    case member_kind::string_scalar:
+    {
+      string_type value;
+      if(!detail::read_string( data, key, value )) return false;
+      converter.assign( converter, &value, member );
+      return true;
+    }
+    case member_kind::string_view_scalar:
     {
-      const string_vector_member ptr = pair.second;
+      string_view_type value;
+      if(!detail::read_string_view( data, key, value )) return false;
+      converter.assign( converter, &value, member );
+      return true;
+    }
+    default:
+      return false;
+    }
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename TranslationScheme, typename Key>
+  inline bool
+    DataTranslator<T,B,I,F,S,K,A>::translate_converted_vector( value_type* object,
+                                                             const member_entry& entry,
+                                                             const Key& key,
+                                                             const TranslationScheme& data,
+                                                             translate_mode mode )
+    const
+  {
+    typedef concepts::ScalarTranslationScheme_as_string_view_sequence<TranslationScheme,string_view_type,Key> can_view;
 
-      if(data.has(pair.first))
+    const auto& converter = *entry.converter;
+    void* const vector    = &member_at<unsigned char>(object,entry.offset);
+
+    // Schemes that cannot lend out their strings leave the member untouched
+    if(converter.source == member_kind::string_view_scalar && !can_view::value) return false;
+    if(!data.has(key)) return false;
+
+    // Existing elements are overwritten in place, as with the other vectors
+    size_type index = (mode == translate_mode::replace) ? 0 : converter.size(vector);
+    converter.reserve( vector, index + data.size(key) );
+
+    switch(converter.source)
+    {
+    case member_kind::bool_scalar:
+      data.template as_bool_sequence(key, [&](const bool_type& value)
       {
-        ++count;
-        ((*object).*ptr).reserve(data.size(pair.first));
-        data.template as_string_sequence(pair.first, [&](const string_type& value)
-        {
-          ((*object).*ptr).push_back(value);
-        });
-      }
+        converter.write( converter, &value, vector, index++ );
+      });
+      break;
+    case member_kind::int_scalar:
+      data.template as_int_sequence(key, [&](const int_type& value)
+      {
+        converter.write( converter, &value, vector, index++ );
+      });
+      break;
+    case member_kind::float_scalar:
+      data.template as_float_sequence(key, [&](const float_type& value)
+      {
+        converter.write( converter, &value, vector, index++ );
+      });
+      break;
+    case member_kind::string_scalar:
+      data.template as_string_sequence(key, [&](const string_type& value)
+      {
+        converter.write( converter, &value, vector, index++ );
+      });
+      break;
+    case member_kind::string_view_scalar:
+      detail::for_each_string_view<string_view_type>(data, key, [&](const string_view_type& value)
+      {
+        converter.write( converter, &value, vector, index++ );
+      });
+      break;
+    default:
+      break;
     }
-    return count;
+    converter.truncate( vector, index );
+    return true;
+  }
+
+  //--------------------------------------------------------------------------
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename U>
+  inline typename DataTranslator<T,B,I,F,S,K,A>::size_type
+    DataTranslator<T,B,I,F,S,K,A>::offset_of( U value_type::*member )
+    noexcept
+  {
+    // A pointer-to-member of value_type can never name a member of a virtual
+    // base, so it always resolves to a fixed offset. Resolve it against
+    // suitably aligned storage without constructing a value_type.
+    typedef typename std::aligned_storage<sizeof(value_type),alignof(value_type)>::type storage_type;
+
+    const storage_type storage{};
+    const auto* base  = static_cast<const unsigned char*>(static_cast<const void*>(&storage));
+    const auto* field = static_cast<const unsigned char*>(static_cast<const void*>(
+      &(static_cast<const value_type*>(static_cast<const void*>(&storage))->*member)
+    ));
+    return static_cast<size_type>(field - base);
+  }
+
+  template<typename T, typename B, typename I, typename F, typename S, typename K, template<typename> class A>
+  template<typename U>
+  inline U&
+    DataTranslator<T,B,I,F,S,K,A>::member_at( value_type* object,
+                                            size_type offset )
+    noexcept
+  {
+    auto* base = static_cast<unsigned char*>(static_cast<void*>(object));
+    return *static_cast<U*>(static_cast<void*>(base + offset));
   }
 
 } // namespace serial
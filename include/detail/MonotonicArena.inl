@@ -0,0 +1,348 @@
+#ifndef DATATRANSLATOR_DETAIL_MONOTONICARENA_INL_
+#define DATATRANSLATOR_DETAIL_MONOTONICARENA_INL_
+
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__linux__)
+# include <sys/mman.h>
+#endif
+
+namespace serial {
+
+  //--------------------------------------------------------------------------
+  // monotonic_arena
+  //--------------------------------------------------------------------------
+
+  inline monotonic_arena::monotonic_arena( size_type block_size,
+                                           bool huge_pages )
+    noexcept
+    : m_blocks(nullptr),
+      m_cursor(nullptr),
+      m_end(nullptr),
+      m_block_size(block_size),
+      m_allocated(0),
+      m_huge_pages(huge_pages)
+  {
+
+  }
+
+  inline monotonic_arena::~monotonic_arena()
+  {
+    release();
+  }
+
+  //--------------------------------------------------------------------------
+  // Allocation
+  //--------------------------------------------------------------------------
+
+  inline void* monotonic_arena::allocate( size_type size,
+                                          size_type alignment )
+  {
+    auto address = reinterpret_cast<std::uintptr_t>(m_cursor);
+    auto aligned = (address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+
+    if(m_cursor == nullptr || aligned + size > reinterpret_cast<std::uintptr_t>(m_end))
+    {
+      // Oversized requests get a block of their own
+      const size_type header = (sizeof(block) + alignment - 1) & ~(alignment - 1);
+      block* b = allocate_block( std::max(m_block_size, header + size) );
+
+      b->next  = m_blocks;
+      m_blocks = b;
+      m_cursor = reinterpret_cast<unsigned char*>(b) + sizeof(block);
+      m_end    = reinterpret_cast<unsigned char*>(b) + b->size;
+
+      address = reinterpret_cast<std::uintptr_t>(m_cursor);
+      aligned = (address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+    }
+
+    m_cursor     = reinterpret_cast<unsigned char*>(aligned + size);
+    m_allocated += size;
+    return reinterpret_cast<void*>(aligned);
+  }
+
+  inline void monotonic_arena::release()
+    noexcept
+  {
+    while(m_blocks)
+    {
+      block* next = m_blocks->next;
+      free_block(m_blocks);
+      m_blocks = next;
+    }
+    m_cursor    = nullptr;
+    m_end       = nullptr;
+    m_allocated = 0;
+  }
+
+  inline monotonic_arena::size_type monotonic_arena::allocated()
+    const noexcept
+  {
+    return m_allocated;
+  }
+
+  inline monotonic_arena* monotonic_arena::current()
+    noexcept
+  {
+    return current_arena();
+  }
+
+  //--------------------------------------------------------------------------
+  // Private Member Functions
+  //--------------------------------------------------------------------------
+
+  inline monotonic_arena::block* monotonic_arena::allocate_block( size_type size )
+  {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if(m_huge_pages)
+    {
+      const size_type huge_page_size = 2 * 1024 * 1024;
+      const size_type mapped_size    = (size + huge_page_size - 1) & ~(huge_page_size - 1);
+
+      void* memory = ::mmap( nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+      if(memory != MAP_FAILED)
+      {
+        // Transparent huge pages are only a hint; the mapping is used either way
+        ::madvise( memory, mapped_size, MADV_HUGEPAGE );
+
+        block* b = static_cast<block*>(memory);
+        b->size   = mapped_size;
+        b->mapped = true;
+        return b;
+      }
+    }
+#endif
+    block* b = static_cast<block*>(::operator new(size));
+    b->size   = size;
+    b->mapped = false;
+    return b;
+  }
+
+  inline void monotonic_arena::free_block( block* b )
+    noexcept
+  {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if(b->mapped)
+    {
+      ::munmap( b, b->size );
+      return;
+    }
+#endif
+    ::operator delete(b);
+  }
+
+  inline monotonic_arena*& monotonic_arena::current_arena()
+    noexcept
+  {
+    static thread_local monotonic_arena* arena = nullptr;
+    return arena;
+  }
+
+  //--------------------------------------------------------------------------
+  // arena_scope
+  //--------------------------------------------------------------------------
+
+  inline arena_scope::arena_scope( monotonic_arena& arena )
+    noexcept
+    : m_previous(monotonic_arena::current_arena())
+  {
+    monotonic_arena::current_arena() = &arena;
+  }
+
+  inline arena_scope::~arena_scope()
+  {
+    monotonic_arena::current_arena() = m_previous;
+  }
+
+  //--------------------------------------------------------------------------
+  // arena_allocator
+  //--------------------------------------------------------------------------
+
+  template<typename T>
+  inline arena_allocator<T>::arena_allocator()
+    noexcept
+    : m_arena(monotonic_arena::current())
+  {
+
+  }
+
+  template<typename T>
+  inline arena_allocator<T>::arena_allocator( monotonic_arena* arena )
+    noexcept
+    : m_arena(arena)
+  {
+
+  }
+
+  template<typename T>
+  template<typename U>
+  inline arena_allocator<T>::arena_allocator( const arena_allocator<U>& other )
+    noexcept
+    : m_arena(other.arena())
+  {
+
+  }
+
+  template<typename T>
+  inline T* arena_allocator<T>::allocate( size_type n )
+  {
+    if(m_arena)
+    {
+      return static_cast<T*>(m_arena->allocate( n * sizeof(T), alignof(T) ));
+    }
+    return static_cast<T*>(::operator new( n * sizeof(T) ));
+  }
+
+  template<typename T>
+  inline void arena_allocator<T>::deallocate( T* p, size_type )
+    noexcept
+  {
+    if(!m_arena) ::operator delete(p);
+  }
+
+  template<typename T>
+  inline monotonic_arena* arena_allocator<T>::arena()
+    const noexcept
+  {
+    return m_arena;
+  }
+
+  template<typename T, typename U>
+  inline bool operator==( const arena_allocator<T>& lhs, const arena_allocator<U>& rhs )
+    noexcept
+  {
+    return lhs.arena() == rhs.arena();
+  }
+
+  template<typename T, typename U>
+  inline bool operator!=( const arena_allocator<T>& lhs, const arena_allocator<U>& rhs )
+    noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+  //--------------------------------------------------------------------------
+  // basic_arena_string
+  //--------------------------------------------------------------------------
+
+  template<typename CharT>
+  inline basic_arena_string<CharT>::basic_arena_string()
+    noexcept
+    : m_data(nullptr),
+      m_size(0)
+  {
+
+  }
+
+  template<typename CharT>
+  template<typename StringT, typename>
+  inline basic_arena_string<CharT>::basic_arena_string( const StringT& str )
+    : basic_arena_string(current_arena(), str)
+  {
+
+  }
+
+  template<typename CharT>
+  template<typename StringT>
+  inline basic_arena_string<CharT>::basic_arena_string( monotonic_arena& arena,
+                                                        const StringT& str )
+    : m_data(nullptr),
+      m_size(0)
+  {
+    const auto range = detail::make_key_range(str);
+
+    if(range.size() == 0) return;
+
+    m_data = copy( arena, range.data(), range.size() );
+    m_size = range.size();
+  }
+
+  //--------------------------------------------------------------------------
+  // Observers
+  //--------------------------------------------------------------------------
+
+  template<typename CharT>
+  inline const CharT* basic_arena_string<CharT>::data()
+    const noexcept
+  {
+    static const CharT empty = CharT();
+    return m_data ? m_data : &empty;
+  }
+
+  template<typename CharT>
+  inline const CharT* basic_arena_string<CharT>::c_str()
+    const noexcept
+  {
+    return data();
+  }
+
+  template<typename CharT>
+  inline typename basic_arena_string<CharT>::size_type
+    basic_arena_string<CharT>::size()
+    const noexcept
+  {
+    return m_size;
+  }
+
+  template<typename CharT>
+  inline bool basic_arena_string<CharT>::empty()
+    const noexcept
+  {
+    return m_size == 0;
+  }
+
+  template<typename CharT>
+  inline typename basic_arena_string<CharT>::const_iterator
+    basic_arena_string<CharT>::begin()
+    const noexcept
+  {
+    return data();
+  }
+
+  template<typename CharT>
+  inline typename basic_arena_string<CharT>::const_iterator
+    basic_arena_string<CharT>::end()
+    const noexcept
+  {
+    return data() + m_size;
+  }
+
+  template<typename CharT>
+  template<typename Traits, typename Allocator>
+  inline basic_arena_string<CharT>::operator std::basic_string<CharT,Traits,Allocator>()
+    const
+  {
+    return std::basic_string<CharT,Traits,Allocator>( data(), m_size );
+  }
+
+  //--------------------------------------------------------------------------
+  // Private Member Functions
+  //--------------------------------------------------------------------------
+
+  template<typename CharT>
+  inline const CharT* basic_arena_string<CharT>::copy( monotonic_arena& arena,
+                                                       const CharT* str,
+                                                       size_type size )
+  {
+    CharT* chars = static_cast<CharT*>(arena.allocate( (size + 1) * sizeof(CharT), alignof(CharT) ));
+
+    std::char_traits<CharT>::copy( chars, str, size );
+    chars[size] = CharT();
+    return chars;
+  }
+
+  template<typename CharT>
+  inline monotonic_arena& basic_arena_string<CharT>::current_arena()
+  {
+    monotonic_arena* arena = monotonic_arena::current();
+    if(!arena)
+    {
+      throw std::logic_error("arena strings can only be constructed within an arena_scope");
+    }
+    return *arena;
+  }
+
+} // namespace serial
+
+#endif /* DATATRANSLATOR_DETAIL_MONOTONICARENA_INL_ */
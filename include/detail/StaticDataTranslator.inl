@@ -0,0 +1,416 @@
+#ifndef DATATRANSLATOR_DETAIL_STATICDATATRANSLATOR_INL_
+#define DATATRANSLATOR_DETAIL_STATICDATATRANSLATOR_INL_
+
+namespace serial {
+  namespace detail {
+
+    //------------------------------------------------------------------------
+    // Member Traits
+    //------------------------------------------------------------------------
+
+    template<typename C, typename U>
+    struct member_pointer_traits<U C::*>
+    {
+      typedef C class_type;
+      typedef U member_type;
+    };
+
+    template<typename U>
+    struct scalar_member_kind : std::integral_constant<member_kind,
+      std::is_same<U,bool>::value     ? member_kind::bool_scalar :
+      std::is_integral<U>::value       ? member_kind::int_scalar :
+      std::is_floating_point<U>::value ? member_kind::float_scalar :
+                                         member_kind::string_scalar
+    >{};
+
+    template<typename CharT>
+    struct scalar_member_kind<basic_string_view<CharT>>
+      : std::integral_constant<member_kind,member_kind::string_view_scalar>{};
+
+    template<typename U>
+    struct value_member_kind : scalar_member_kind<U>{};
+
+    template<typename U, typename Allocator>
+    struct value_member_kind<std::vector<U,Allocator>> : std::integral_constant<member_kind,
+      std::is_same<U,bool>::value     ? member_kind::bool_vector :
+      std::is_integral<U>::value       ? member_kind::int_vector :
+      std::is_floating_point<U>::value ? member_kind::float_vector :
+                                         member_kind::string_vector
+    >{};
+
+    template<typename CharT, typename Allocator>
+    struct value_member_kind<std::vector<basic_string_view<CharT>,Allocator>>
+      : std::integral_constant<member_kind,member_kind::string_view_vector>{};
+
+    template<typename C, typename U>
+    struct default_member_kind<U C::*> : value_member_kind<U>{};
+
+    //------------------------------------------------------------------------
+    // Static Keys
+    //------------------------------------------------------------------------
+
+    template<typename Key>
+    using static_key_t = typename std::decay<decltype(Key::value())>::type;
+
+    /// \brief Gets the handle that schemes of type \p TranslationScheme
+    ///        prepare for \p Key, preparing it on first use
+    template<typename Key, typename TranslationScheme>
+    inline const prepared_key_t<TranslationScheme,static_key_t<Key>>&
+      static_key( const TranslationScheme& data, std::true_type )
+    {
+      // Prepared exactly once for each key and scheme type
+      static const prepared_key_t<TranslationScheme,static_key_t<Key>> key = data.prepare(Key::value());
+      return key;
+    }
+
+    template<typename Key>
+    using static_hashed_key_t = basic_hashed_key<
+      typename std::remove_cv<typename std::remove_pointer<static_key_t<Key>>::type>::type
+    >;
+
+    /// \brief Gets \p Key with its hash, computed at compile time
+    template<typename Key, typename TranslationScheme>
+    inline static_hashed_key_t<Key>
+      static_hashed_key( const TranslationScheme&, std::true_type )
+    {
+      static constexpr static_hashed_key_t<Key> key = static_hashed_key_t<Key>( Key::value() );
+      return key;
+    }
+
+    template<typename Key, typename TranslationScheme>
+    inline static_key_t<Key>
+      static_hashed_key( const TranslationScheme&, std::false_type )
+    {
+      return Key::value();
+    }
+
+    template<typename Key, typename TranslationScheme>
+    inline auto
+      static_key( const TranslationScheme& data, std::false_type )
+      -> decltype(static_hashed_key<Key>( data, concepts::ScalarTranslationScheme_has<TranslationScheme,static_hashed_key_t<Key>>() ))
+    {
+      return static_hashed_key<Key>( data, concepts::ScalarTranslationScheme_has<TranslationScheme,static_hashed_key_t<Key>>() );
+    }
+
+    //------------------------------------------------------------------------
+    // Member Translation
+    //------------------------------------------------------------------------
+
+    template<member_kind Kind>
+    struct static_member_translator;
+
+    template<>
+    struct static_member_translator<member_kind::bool_scalar>
+    {
+      template<typename U, typename Key, typename TranslationScheme>
+      static bool translate( U& member,
+                             const Key& key,
+                             const TranslationScheme& data,
+                             translate_mode )
+      {
+        static_assert(concepts::ScalarTranslationScheme_has<TranslationScheme,Key>::value,"static_member requires const function 'has(key)' to return a type convertible to bool");
+        static_assert(concepts::ScalarTranslationScheme_as_bool<TranslationScheme,U,Key>::value,"static_member requires const function 'as_bool(key)' to return a type convertible to the member type");
+
+        return detail::read_bool( data, key, member );
+      }
+    };
+
+    template<>
+    struct static_member_translator<member_kind::int_scalar>
+    {
+      template<typename U, typename Key, typename TranslationScheme>
+      static bool translate( U& member,
+                             const Key& key,
+                             const TranslationScheme& data,
+                             translate_mode )
+      {
+        static_assert(concepts::ScalarTranslationScheme_has<TranslationScheme,Key>::value,"static_member requires const function 'has(key)' to return a type convertible to bool");
+        static_assert(concepts::ScalarTranslationScheme_as_int<TranslationScheme,U,Key>::value,"static_member requires const function 'as_int(key)' to return a type convertible to the member type");
+
+        return detail::read_int( data, key, member );
+      }
+    };
+
+    template<>
+    struct static_member_translator<member_kind::float_scalar>
+    {
+      template<typename U, typename Key, typename TranslationScheme>
+      static bool translate( U& member,
+                             const Key& key,
+                             const TranslationScheme& data,
+                             translate_mode )
+      {
+        static_assert(concepts::ScalarTranslationScheme_has<TranslationScheme,Key>::value,"static_member requires const function 'has(key)' to return a type convertible to bool");
+        static_assert(concepts::ScalarTranslationScheme_as_float<TranslationScheme,U,Key>::value,"static_member requires const function 'as_float(key)' to return a type convertible to the member type");
+
+        return detail::read_float( data, key, member );
+      }
+    };
+
+    template<>
+    struct static_member_translator<member_kind::string_scalar>
+    {
+      template<typename U, typename Key, typename TranslationScheme>
+      static bool translate( U& member,
+                             const Key& key,
+                             const TranslationScheme& data,
+                             translate_mode )
+      {
+        static_assert(concepts::ScalarTranslationScheme_has<TranslationScheme,Key>::value,"static_member requires const function 'has(key)' to return a type convertible to bool");
+        static_assert(concepts::ScalarTranslationScheme_as_string<TranslationScheme,U,Key>::value,"static_member requires const function 'as_string(key)' to return a type convertible to the member type");
+
+        return detail::read_string( data, key, member );
+      }
+    };
+
+    template<>
+    struct static_member_translator<member_kind::string_view_scalar>
+    {
+      template<typename U, typename Key, typename TranslationScheme>
+      static bool translate( U& member,
+                             const Key& key,
+                             const TranslationScheme& data,
+                             translate_mode )
+      {
+        static_assert(concepts::ScalarTranslationScheme_has<TranslationScheme,Key>::value,"static_member requires const function 'has(key)' to return a type convertible to bool");
+        static_assert(concepts::ScalarTranslationScheme_as_string_view<TranslationScheme,U,Key>::value,"static_member requires const function 'as_string_view(key)' to return a type convertible to the member type");
+
+        return detail::read_string_view( data, key, member );
+      }
+    };
+
+    //------------------------------------------------------------------------
+
+    template<>
+    struct static_member_translator<member_kind::bool_vector>
+    {
+      template<typename U, typename Key, typename TranslationScheme>
+      static bool translate( U& member,
+                             const Key& key,
+                             const TranslationScheme& data,
+                             translate_mode mode )
+      {
+        typedef typename U::value_type element_type;
+
+        static_assert(concepts::ScalarTranslationScheme_has<TranslationScheme,Key>::value,"static_member requires const function 'has(key)' to return a type convertible to bool");
+        static_assert(concepts::ScalarTranslationScheme_size<TranslationScheme,Key>::value,"static_member requires const function 'size(key)' to return a type convertible to std::size_t");
+        static_assert(concepts::ScalarTranslationScheme_as_bool_sequence<TranslationScheme,element_type,Key>::value,"static_member requires const function 'as_bool_sequence(key,func)' to accept a function that takes the element type as argument");
+
+        return detail::read_bool_sequence( data, key, member, mode == translate_mode::replace );
+      }
+    };
+
+    template<>
+    struct static_member_translator<member_kind::int_vector>
+    {
+      template<typename U, typename Key, typename TranslationScheme>
+      static bool translate( U& member,
+                             const Key& key,
+                             const TranslationScheme& data,
+                             translate_mode mode )
+      {
+        typedef typename U::value_type element_type;
+
+        static_assert(concepts::ScalarTranslationScheme_has<TranslationScheme,Key>::value,"static_member requires const function 'has(key)' to return a type convertible to bool");
+        static_assert(concepts::ScalarTranslationScheme_size<TranslationScheme,Key>::value,"static_member requires const function 'size(key)' to return a type convertible to std::size_t");
+        static_assert(concepts::ScalarTranslationScheme_as_int_sequence<TranslationScheme,element_type,Key>::value,"static_member requires const function 'as_int_sequence(key,func)' to accept a function that takes the element type as argument");
+
+        return detail::read_int_sequence( data, key, member, mode == translate_mode::replace );
+      }
+    };
+
+    template<>
+    struct static_member_translator<member_kind::float_vector>
+    {
+      template<typename U, typename Key, typename TranslationScheme>
+      static bool translate( U& member,
+                             const Key& key,
+                             const TranslationScheme& data,
+                             translate_mode mode )
+      {
+        typedef typename U::value_type element_type;
+
+        static_assert(concepts::ScalarTranslationScheme_has<TranslationScheme,Key>::value,"static_member requires const function 'has(key)' to return a type convertible to bool");
+        static_assert(concepts::ScalarTranslationScheme_size<TranslationScheme,Key>::value,"static_member requires const function 'size(key)' to return a type convertible to std::size_t");
+        static_assert(concepts::ScalarTranslationScheme_as_float_sequence<TranslationScheme,element_type,Key>::value,"static_member requires const function 'as_float_sequence(key,func)' to accept a function that takes the element type as argument");
+
+        return detail::read_float_sequence( data, key, member, mode == translate_mode::replace );
+      }
+    };
+
+    template<>
+    struct static_member_translator<member_kind::string_vector>
+    {
+      template<typename U, typename Key, typename TranslationScheme>
+      static bool translate( U& member,
+                             const Key& key,
+                             const TranslationScheme& data,
+                             translate_mode mode )
+      {
+        typedef typename U::value_type element_type;
+
+        static_assert(concepts::ScalarTranslationScheme_has<TranslationScheme,Key>::value,"static_member requires const function 'has(key)' to return a type convertible to bool");
+        static_assert(concepts::ScalarTranslationScheme_size<TranslationScheme,Key>::value,"static_member requires const function 'size(key)' to return a type convertible to std::size_t");
+        static_assert(concepts::ScalarTranslationScheme_as_string_sequence<TranslationScheme,element_type,Key>::value,"static_member requires const function 'as_string_sequence(key,func)' to accept a function that takes the element type as argument");
+
+        return detail::read_string_sequence( data, key, member, mode == translate_mode::replace );
+      }
+    };
+
+    template<>
+    struct static_member_translator<member_kind::string_view_vector>
+    {
+      template<typename U, typename Key, typename TranslationScheme>
+      static bool translate( U& member,
+                             const Key& key,
+                             const TranslationScheme& data,
+                             translate_mode mode )
+      {
+        typedef typename U::value_type element_type;
+
+        static_assert(concepts::ScalarTranslationScheme_has<TranslationScheme,Key>::value,"static_member requires const function 'has(key)' to return a type convertible to bool");
+        static_assert(concepts::ScalarTranslationScheme_size<TranslationScheme,Key>::value,"static_member requires const function 'size(key)' to return a type convertible to std::size_t");
+        static_assert(concepts::ScalarTranslationScheme_as_string_view_sequence<TranslationScheme,element_type,Key>::value,"static_member requires const function 'as_string_view_sequence(key,func)' to accept a function that takes the element type as argument");
+
+        return detail::read_string_view_sequence( data, key, member, mode == translate_mode::replace );
+      }
+    };
+
+  } // namespace detail
+
+  //--------------------------------------------------------------------------
+  // static_member
+  //--------------------------------------------------------------------------
+
+  template<typename Key, typename Member, Member Ptr, member_kind Kind>
+  constexpr member_kind static_member<Key,Member,Ptr,Kind>::kind;
+
+  template<typename Key, typename Member, Member Ptr, member_kind Kind>
+  template<typename TranslationScheme>
+  inline bool
+    static_member<Key,Member,Ptr,Kind>::translate( class_type& object,
+                                                   const TranslationScheme& data,
+                                                   translate_mode mode )
+  {
+    typedef concepts::ScalarTranslationScheme_prepare<TranslationScheme,detail::static_key_t<Key>> is_preparing;
+
+    return detail::static_member_translator<Kind>::translate( object.*Ptr,
+                                                              detail::static_key<Key>( data, is_preparing() ),
+                                                              data,
+                                                              mode );
+  }
+
+  template<typename Key, typename Member, Member Ptr, member_kind Kind>
+  inline void
+    static_member<Key,Member,Ptr,Kind>::reset( class_type& object )
+  {
+    detail::reset_member( object.*Ptr );
+  }
+
+  //--------------------------------------------------------------------------
+  // Capacity
+  //--------------------------------------------------------------------------
+
+  template<typename T, typename...Members>
+  inline constexpr typename StaticDataTranslator<T,Members...>::size_type
+    StaticDataTranslator<T,Members...>::members()
+    noexcept
+  {
+    return sizeof...(Members);
+  }
+
+  //--------------------------------------------------------------------------
+  // Loaders
+  //--------------------------------------------------------------------------
+
+  template<typename T, typename...Members>
+  template<typename ScalarTranslationScheme>
+  inline typename StaticDataTranslator<T,Members...>::size_type
+    StaticDataTranslator<T,Members...>::translate( value_type* object,
+                                                   const ScalarTranslationScheme& data,
+                                                   translate_mode mode )
+    const
+  {
+    size_type count = 0;
+
+    // Expands to one inlined translation per member, in declaration order
+    typedef int expand[];
+    (void) expand{ 0, (count += Members::translate( *object, data, mode ), 0)... };
+
+    return count;
+  }
+
+  template<typename T, typename...Members>
+  inline void
+    StaticDataTranslator<T,Members...>::reset( value_type* object )
+    const
+  {
+    typedef int expand[];
+    (void) expand{ 0, (Members::reset( *object ), 0)... };
+  }
+
+  template<typename T, typename...Members>
+  template<typename ScalarTranslationScheme>
+  inline typename StaticDataTranslator<T,Members...>::size_type
+    StaticDataTranslator<T,Members...>::translate_uniform( value_type* objects,
+                                                           size_type size,
+                                                           const ScalarTranslationScheme& data )
+    const
+  {
+    return detail::translate_uniform( *this, objects, size, data );
+  }
+
+  template<typename T, typename...Members>
+  template<typename OutputIterator, typename SequenceTranslationScheme>
+  inline typename StaticDataTranslator<T,Members...>::size_type
+    StaticDataTranslator<T,Members...>::translate_sequence( OutputIterator it,
+                                                            SequenceTranslationScheme& data )
+    const
+  {
+    static_assert(concepts::SequenceTranslationScheme_next<SequenceTranslationScheme>::value,"SequenceTranslationScheme concept requires non-const function 'next()' to return a type convertible to bool");
+
+    return detail::translate_sequence( *this, it, data );
+  }
+
+  template<typename T, typename...Members>
+  template<typename OutputIterator, typename SequenceTranslationScheme>
+  inline typename StaticDataTranslator<T,Members...>::size_type
+    StaticDataTranslator<T,Members...>::translate_sequence( OutputIterator it,
+                                                            size_type size,
+                                                            SequenceTranslationScheme& data )
+    const
+  {
+    static_assert(concepts::SequenceTranslationScheme_next<SequenceTranslationScheme>::value,"SequenceTranslationScheme concept requires non-const function 'next()' to return a type convertible to bool");
+
+    return detail::translate_sequence( *this, it, size, data );
+  }
+
+  template<typename T, typename...Members>
+  template<typename Container, typename SequenceTranslationScheme>
+  inline typename StaticDataTranslator<T,Members...>::size_type
+    StaticDataTranslator<T,Members...>::translate_sequence_into( Container& objects,
+                                                                 SequenceTranslationScheme& data )
+    const
+  {
+    static_assert(concepts::SequenceTranslationScheme_next<SequenceTranslationScheme>::value,"SequenceTranslationScheme concept requires non-const function 'next()' to return a type convertible to bool");
+
+    return detail::translate_sequence_into( *this, objects, data );
+  }
+
+  template<typename T, typename...Members>
+  template<typename RandomAccessIterator, typename RandomAccessSequenceTranslationScheme>
+  inline typename StaticDataTranslator<T,Members...>::size_type
+    StaticDataTranslator<T,Members...>::translate_sequence_parallel( RandomAccessIterator it,
+                                                                     const RandomAccessSequenceTranslationScheme& data,
+                                                                     size_type threads )
+    const
+  {
+    static_assert(concepts::RandomAccessSequenceTranslationScheme_count<RandomAccessSequenceTranslationScheme>::value,"RandomAccessSequenceTranslationScheme concept requires const function 'count()' to return a type convertible to std::size_t");
+    static_assert(concepts::RandomAccessSequenceTranslationScheme_at<RandomAccessSequenceTranslationScheme>::value,"RandomAccessSequenceTranslationScheme concept requires const function 'at(std::size_t)' to return a ScalarTranslationScheme");
+
+    return detail::translate_sequence_parallel( *this, it, data, threads );
+  }
+
+} // namespace serial
+
+#endif /* DATATRANSLATOR_DETAIL_STATICDATATRANSLATOR_INL_ */
@@ -0,0 +1,258 @@
+#ifndef DATATRANSLATOR_DETAIL_STRINGPOOL_INL_
+#define DATATRANSLATOR_DETAIL_STRINGPOOL_INL_
+
+namespace serial {
+
+  //--------------------------------------------------------------------------
+  // basic_string_pool
+  //--------------------------------------------------------------------------
+
+  template<typename CharT>
+  constexpr typename basic_string_pool<CharT>::size_type basic_string_pool<CharT>::shard_count;
+
+  template<typename CharT>
+  template<typename StringT>
+  inline const typename basic_string_pool<CharT>::string_type&
+    basic_string_pool<CharT>::intern( const StringT& str )
+  {
+    const auto range = detail::make_key_range(str);
+    const auto hash  = detail::hash_key(range);
+
+    // The high bits pick the shard, so that the low bits still spread
+    // strings across the buckets of each shard
+    shard& s = m_shards[(hash >> 56) % shard_count];
+
+    std::lock_guard<std::mutex> lock(s.mutex);
+
+    const auto matches = s.strings.equal_range(hash);
+    for( auto it = matches.first; it != matches.second; ++it )
+    {
+      if(detail::key_equal(it->second, range)) return it->second;
+    }
+    return s.strings.emplace( hash, string_type(range.data(), range.size()) )->second;
+  }
+
+  template<typename CharT>
+  inline typename basic_string_pool<CharT>::size_type
+    basic_string_pool<CharT>::size()
+    const
+  {
+    size_type count = 0;
+    for( const auto& s : m_shards )
+    {
+      std::lock_guard<std::mutex> lock(s.mutex);
+      count += s.strings.size();
+    }
+    return count;
+  }
+
+  template<typename CharT>
+  inline void basic_string_pool<CharT>::clear()
+  {
+    for( auto& s : m_shards )
+    {
+      std::lock_guard<std::mutex> lock(s.mutex);
+      s.strings.clear();
+    }
+  }
+
+  template<typename CharT>
+  inline basic_string_pool<CharT>& basic_string_pool<CharT>::global()
+  {
+    static basic_string_pool pool;
+    return pool;
+  }
+
+  template<typename CharT>
+  inline basic_string_pool<CharT>& basic_string_pool<CharT>::current()
+    noexcept
+  {
+    basic_string_pool* pool = current_pool();
+    return pool ? *pool : global();
+  }
+
+  template<typename CharT>
+  inline basic_string_pool<CharT>*& basic_string_pool<CharT>::current_pool()
+    noexcept
+  {
+    static thread_local basic_string_pool* pool = nullptr;
+    return pool;
+  }
+
+  //--------------------------------------------------------------------------
+  // basic_intern_scope
+  //--------------------------------------------------------------------------
+
+  template<typename CharT>
+  inline basic_intern_scope<CharT>::basic_intern_scope( basic_string_pool<CharT>& pool )
+    noexcept
+    : m_previous(basic_string_pool<CharT>::current_pool())
+  {
+    basic_string_pool<CharT>::current_pool() = &pool;
+  }
+
+  template<typename CharT>
+  inline basic_intern_scope<CharT>::~basic_intern_scope()
+  {
+    basic_string_pool<CharT>::current_pool() = m_previous;
+  }
+
+  //--------------------------------------------------------------------------
+  // basic_interned_string
+  //--------------------------------------------------------------------------
+
+  template<typename CharT>
+  inline basic_interned_string<CharT>::basic_interned_string()
+    noexcept
+    : m_string(nullptr)
+  {
+
+  }
+
+  template<typename CharT>
+  template<typename StringT, typename>
+  inline basic_interned_string<CharT>::basic_interned_string( const StringT& str )
+    : m_string(&basic_string_pool<CharT>::current().intern(str))
+  {
+
+  }
+
+  template<typename CharT>
+  template<typename StringT>
+  inline basic_interned_string<CharT>::basic_interned_string( basic_string_pool<CharT>& pool,
+                                                              const StringT& str )
+    : m_string(&pool.intern(str))
+  {
+
+  }
+
+  //--------------------------------------------------------------------------
+  // Observers
+  //--------------------------------------------------------------------------
+
+  template<typename CharT>
+  inline const typename basic_interned_string<CharT>::string_type&
+    basic_interned_string<CharT>::str()
+    const noexcept
+  {
+    return m_string ? *m_string : empty_string();
+  }
+
+  template<typename CharT>
+  inline const CharT* basic_interned_string<CharT>::data()
+    const noexcept
+  {
+    return str().data();
+  }
+
+  template<typename CharT>
+  inline const CharT* basic_interned_string<CharT>::c_str()
+    const noexcept
+  {
+    return str().c_str();
+  }
+
+  template<typename CharT>
+  inline typename basic_interned_string<CharT>::size_type
+    basic_interned_string<CharT>::size()
+    const noexcept
+  {
+    return str().size();
+  }
+
+  template<typename CharT>
+  inline bool basic_interned_string<CharT>::empty()
+    const noexcept
+  {
+    return str().empty();
+  }
+
+  template<typename CharT>
+  inline typename basic_interned_string<CharT>::const_iterator
+    basic_interned_string<CharT>::begin()
+    const noexcept
+  {
+    return data();
+  }
+
+  template<typename CharT>
+  inline typename basic_interned_string<CharT>::const_iterator
+    basic_interned_string<CharT>::end()
+    const noexcept
+  {
+    return data() + size();
+  }
+
+  template<typename CharT>
+  inline basic_interned_string<CharT>::operator const string_type&()
+    const noexcept
+  {
+    return str();
+  }
+
+  template<typename CharT>
+  inline const typename basic_interned_string<CharT>::string_type&
+    basic_interned_string<CharT>::empty_string()
+    noexcept
+  {
+    static const string_type empty;
+    return empty;
+  }
+
+  //--------------------------------------------------------------------------
+  // Comparison
+  //--------------------------------------------------------------------------
+
+  template<typename CharT>
+  inline bool operator==( const basic_interned_string<CharT>& lhs,
+                          const basic_interned_string<CharT>& rhs )
+    noexcept
+  {
+    // Repeated values of the same pool share one pooled string, so most
+    // equal strings are found by address alone
+    return &lhs.str() == &rhs.str() || lhs.str() == rhs.str();
+  }
+
+  template<typename CharT>
+  inline bool operator==( const basic_interned_string<CharT>& lhs,
+                          const std::basic_string<CharT>& rhs )
+    noexcept
+  {
+    return lhs.str() == rhs;
+  }
+
+  template<typename CharT>
+  inline bool operator==( const std::basic_string<CharT>& lhs,
+                          const basic_interned_string<CharT>& rhs )
+    noexcept
+  {
+    return lhs == rhs.str();
+  }
+
+  template<typename CharT>
+  inline bool operator!=( const basic_interned_string<CharT>& lhs,
+                          const basic_interned_string<CharT>& rhs )
+    noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+  template<typename CharT>
+  inline bool operator!=( const basic_interned_string<CharT>& lhs,
+                          const std::basic_string<CharT>& rhs )
+    noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+  template<typename CharT>
+  inline bool operator!=( const std::basic_string<CharT>& lhs,
+                          const basic_interned_string<CharT>& rhs )
+    noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+} // namespace serial
+
+#endif /* DATATRANSLATOR_DETAIL_STRINGPOOL_INL_ */
@@ -0,0 +1,316 @@
+#ifndef DATATRANSLATOR_DETAIL_ALGORITHMS_INL_
+#define DATATRANSLATOR_DETAIL_ALGORITHMS_INL_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace serial {
+  namespace detail {
+
+    //------------------------------------------------------------------------
+    // Type Traits
+    //------------------------------------------------------------------------
+
+    // libstdc++ only provides std::is_trivially_copyable from gcc 5, which is
+    // also when it started defining _GLIBCXX_USE_CXX11_ABI
+#if defined(__GLIBCXX__) && !defined(_GLIBCXX_USE_CXX11_ABI)
+    template<typename T>
+    struct is_trivially_copyable
+      : std::integral_constant<bool,__has_trivial_copy(T) && __has_trivial_assign(T)>{};
+#else
+    template<typename T>
+    struct is_trivially_copyable : std::is_trivially_copyable<T>{};
+#endif
+
+    //------------------------------------------------------------------------
+    // Prefetching
+    //------------------------------------------------------------------------
+
+    /// \brief The number of iterations ahead that batch loops prefetch
+    constexpr std::size_t prefetch_distance = 8;
+
+    /// \brief Hints that \p address will soon be read
+    inline void prefetch_read( const void* address ) noexcept
+    {
+#if defined(__GNUC__)
+      __builtin_prefetch( address, 0 );
+#else
+      (void) address;
+#endif
+    }
+
+    /// \brief Hints that \p address will soon be written
+    inline void prefetch_write( const void* address ) noexcept
+    {
+#if defined(__GNUC__)
+      __builtin_prefetch( address, 1 );
+#else
+      (void) address;
+#endif
+    }
+
+    //------------------------------------------------------------------------
+    // Uniform Fill
+    //------------------------------------------------------------------------
+
+    /// \brief The number of bytes above which a uniform fill stops doubling
+    ///        and copies a cache-sized block repeatedly instead
+    constexpr std::size_t uniform_fill_block_bytes = 64 * 1024;
+
+    /// \brief Fills objects [1,size) with copies of objects[0] for trivially
+    ///        copyable types
+    ///
+    /// The filled prefix is doubled with non-overlapping memcpy calls until it
+    /// reaches a cache-sized block, which is then copied out repeatedly while
+    /// it stays resident in cache.
+    template<typename T>
+    inline void uniform_fill( T* objects, std::size_t size, std::true_type )
+    {
+      const std::size_t block_size = std::max<std::size_t>( 1, uniform_fill_block_bytes / sizeof(T) );
+
+      std::size_t filled = 1;
+      while( filled < size && filled < block_size )
+      {
+        const std::size_t count = std::min( filled, size - filled );
+        std::memcpy( &objects[filled], &objects[0], count * sizeof(T) );
+        filled += count;
+      }
+      while( filled < size )
+      {
+        const std::size_t count = std::min( block_size, size - filled );
+        std::memcpy( &objects[filled], &objects[0], count * sizeof(T) );
+        filled += count;
+      }
+    }
+
+    /// \brief Fills objects [1,size) with copies of objects[0] for types that
+    ///        are not trivially copyable
+    ///
+    /// The objects are already constructed, so each is copy-assigned in order
+    /// to correctly release and duplicate any resources it owns.
+    template<typename T>
+    inline void uniform_fill( T* objects, std::size_t size, std::false_type )
+    {
+      std::fill( objects + 1, objects + size, objects[0] );
+    }
+
+    //------------------------------------------------------------------------
+    // Member Reset
+    //------------------------------------------------------------------------
+
+    template<typename U>
+    inline auto reset_member( U& member, int ) -> decltype(member.clear(), void())
+    {
+      member.clear();
+    }
+
+    template<typename U>
+    inline void reset_member( U& member, long )
+    {
+      member = U();
+    }
+
+    /// \brief Resets \p member to an empty value
+    ///
+    /// Members with a \c clear() function, such as strings and vectors, are
+    /// cleared so that they keep their capacity; any other member is
+    /// assigned a value-initialized \p U.
+    template<typename U>
+    inline void reset_member( U& member )
+    {
+      reset_member( member, 0 );
+    }
+
+    //------------------------------------------------------------------------
+    // Translation Algorithms
+    //------------------------------------------------------------------------
+
+    // These algorithms are shared by every translator type. A translator only
+    // needs to provide 'value_type' and a const 'translate(value_type*,data)'.
+
+    template<typename Translator, typename ScalarTranslationScheme>
+    inline std::size_t
+      translate_uniform( const Translator& translator,
+                         typename Translator::value_type* objects,
+                         std::size_t size,
+                         const ScalarTranslationScheme& data )
+    {
+      typedef typename Translator::value_type value_type;
+
+      if(size==0) return 0;
+
+      // Translate the first object
+      std::size_t result = translator.translate( &objects[0], data );
+
+      // Copy the first object to the rest, bitwise only when that is valid
+      uniform_fill( objects, size, is_trivially_copyable<value_type>() );
+
+      return result;
+    }
+
+    template<typename Translator, typename OutputIterator, typename SequenceTranslationScheme>
+    inline std::size_t
+      translate_sequence( const Translator& translator,
+                          OutputIterator it,
+                          SequenceTranslationScheme& data )
+    {
+      typedef typename Translator::value_type value_type;
+
+      std::size_t entries = 0;
+      do{
+        value_type value;
+        entries += translator.translate( &value, data );
+        (*it) = std::move(value);
+        ++it;
+      } while( data.next() );
+      return entries;
+    }
+
+    template<typename Translator, typename OutputIterator, typename SequenceTranslationScheme>
+    inline std::size_t
+      translate_sequence( const Translator& translator,
+                          OutputIterator it,
+                          std::size_t size,
+                          SequenceTranslationScheme& data )
+    {
+      typedef typename Translator::value_type value_type;
+
+      std::size_t count   = 0;
+      std::size_t entries = 0;
+      do{
+        value_type value;
+        entries += translator.translate( &value, data );
+        (*it) = std::move(value);
+        ++it;
+        ++count;
+      } while( data.next() && count < size );
+      return entries;
+    }
+
+    /// \brief Translates a sequence into the objects of \p objects, reusing
+    ///        the objects it already holds
+    ///
+    /// Existing objects are reset and translated in place, so their vector
+    /// and string members keep their capacity; further objects are
+    /// constructed in place at the end of the container. Objects beyond the
+    /// last entry are erased.
+    ///
+    /// The translator must additionally provide a const 'reset(value_type*)'.
+    template<typename Translator, typename Container, typename SequenceTranslationScheme>
+    inline std::size_t
+      translate_sequence_into( const Translator& translator,
+                               Container& objects,
+                               SequenceTranslationScheme& data )
+    {
+      std::size_t count   = 0;
+      std::size_t entries = 0;
+      do{
+        if(count < objects.size())
+        {
+          auto& object = objects[count];
+          translator.reset( &object );
+          entries += translator.translate( &object, data );
+        }
+        else
+        {
+          objects.emplace_back();
+          entries += translator.translate( &objects.back(), data );
+        }
+        ++count;
+      } while( data.next() );
+
+      objects.erase( objects.begin() + static_cast<std::ptrdiff_t>(count), objects.end() );
+      return entries;
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename RandomAccessIterator, typename RandomAccessSequenceTranslationScheme>
+    inline std::size_t
+      translate_sequence_parallel( const Translator& translator,
+                                   RandomAccessIterator it,
+                                   const RandomAccessSequenceTranslationScheme& data,
+                                   std::size_t threads )
+    {
+      const std::size_t size = data.count();
+
+      if(size == 0) return 0;
+
+      if(threads == 0)
+      {
+        threads = std::max<std::size_t>( 1, std::thread::hardware_concurrency() );
+      }
+      threads = std::min( threads, size );
+
+      // Entries are claimed in chunks from a shared counter, so that idle
+      // workers keep taking work from slower ones until the range is done
+      const std::size_t chunk = std::max<std::size_t>( 1, size / (threads * 16) );
+
+      std::atomic<std::size_t> next(0);
+      std::atomic<std::size_t> entries(0);
+      std::atomic<bool>        failed(false);
+      std::exception_ptr       error;
+      std::mutex               error_mutex;
+
+      auto worker = [&]()
+      {
+        std::size_t translated = 0;
+        try
+        {
+          for(;;)
+          {
+            const std::size_t first = next.fetch_add(chunk);
+            if(first >= size || failed.load(std::memory_order_relaxed)) break;
+
+            const std::size_t last = std::min( first + chunk, size );
+            for( std::size_t i = first; i < last; ++i )
+            {
+              translated += translator.translate( &*(it + static_cast<std::ptrdiff_t>(i)), data.at(i) );
+            }
+          }
+        }
+        catch(...)
+        {
+          std::lock_guard<std::mutex> lock(error_mutex);
+          if(!error) error = std::current_exception();
+          failed = true;
+        }
+        entries += translated;
+      };
+
+      if(threads <= 1)
+      {
+        worker();
+      }
+      else
+      {
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for( std::size_t i = 1; i < threads; ++i )
+        {
+          pool.emplace_back(worker);
+        }
+        worker();
+        for( auto& thread : pool )
+        {
+          thread.join();
+        }
+      }
+
+      if(error) std::rethrow_exception(error);
+
+      return entries;
+    }
+
+  } // namespace detail
+} // namespace serial
+
+#endif /* DATATRANSLATOR_DETAIL_ALGORITHMS_INL_ */
@@ -39,7 +39,9 @@
 # error This file requires compiler and library support for the ISO C++11 standard.
 #endif
 
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 #include "concepts.inl"
 
@@ -67,6 +69,51 @@ namespace serial {
     /// - void as_float_sequence(string, Func) const;
     /// - void as_string_sequence(string, Func) const;
     ///
+    /// Optional Functions:
+    ///
+    /// - bool try_as_bool(string, BoolT&) const;
+    /// - bool try_as_int(string, IntT&) const;
+    /// - bool try_as_float(string, FloatT&) const;
+    /// - bool try_as_string(string, StringT&) const;
+    ///
+    /// - bool try_as_bool_span(string, const BoolT*&, std::size_t&) const;
+    /// - bool try_as_int_span(string, const IntT*&, std::size_t&) const;
+    /// - bool try_as_float_span(string, const FloatT*&, std::size_t&) const;
+    /// - bool try_as_string_span(string, const StringT*&, std::size_t&) const;
+    ///
+    /// The optional 'try_as' functions combine 'has' and 'as' into a single
+    /// lookup, and are used in place of them when they are available. The
+    /// 'span' variants expose a contiguous sequence so that it can be copied
+    /// in bulk.
+    ///
+    /// - handle prepare(string) const;
+    ///
+    /// The optional 'prepare' function converts a key into a handle that is
+    /// passed in place of the key to every other function. It must only
+    /// depend on the key, so that handles can be reused across instances.
+    ///
+    /// - string_view as_string_view(string) const;
+    /// - void as_string_view_sequence(string, Func) const;
+    ///
+    /// The optional 'string_view' functions return views of strings that are
+    /// borrowed from the document backing the scheme, and are required to
+    /// translate \c serial::basic_string_view members. The views must remain
+    /// valid for as long as that document is alive.
+    ///
+    /// - scheme child(string) const;
+    ///
+    /// The optional 'child' function returns a scheme for the node named by
+    /// a single segment of a dotted key, which itself provides 'child'. When
+    /// present, a frozen translator resolves each shared key prefix once,
+    /// and passes only the last segment of each key to the child scheme.
+    ///
+    /// - sequence as_sequence(string) const;
+    ///
+    /// The optional 'as_sequence' function returns a
+    /// RandomAccessSequenceTranslationScheme over the structures in the
+    /// sequence with the given key, and is required to translate vectors of
+    /// structures.
+    ///
     /// \tparam Translator the translation scheme to check
     /// \tparam BoolT      the type to use for boolean types
     /// \tparam IntT       the type to use for integral types
@@ -138,6 +185,84 @@ namespace serial {
       static_assert(SequenceTranslationScheme_next<Translator>::value,"SequenceTranslationScheme concept requires non-const function 'next()' to return a type convertible to bool");
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    /// \class serial::concepts::PullTranslationScheme
+    ///
+    /// \brief The concept for a translation scheme that enumerates the keys
+    ///        it contains
+    ///
+    /// Required Functions:
+    ///
+    /// - void for_each_key(Func) const;
+    ///
+    /// \tparam Translator the translation scheme to check
+    /// \tparam BoolT      the type to use for boolean types
+    /// \tparam IntT       the type to use for integral types
+    /// \tparam FloatT     the type to use for floating point types
+    /// \tparam StringT    the type to use for string types
+    /// \tparam KeyStringT the type to use for key strings
+    //////////////////////////////////////////////////////////////////////////
+    template<
+      typename Translator,
+      typename BoolT,
+      typename IntT,
+      typename FloatT,
+      typename StringT,
+      typename KeyStringT
+    >
+    struct PullTranslationScheme : ScalarTranslationScheme<Translator,
+                                                           BoolT,
+                                                           IntT,
+                                                           FloatT,
+                                                           StringT,
+                                                           KeyStringT>
+    {
+      constexpr PullTranslationScheme(){}
+
+      static_assert(PullTranslationScheme_for_each_key<Translator,KeyStringT>::value,"PullTranslationScheme concept requires const function 'for_each_key(func)' to accept a function that takes 'KeyStringT' as argument");
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \class serial::concepts::RandomAccessSequenceTranslationScheme
+    ///
+    /// \brief The concept for a random access sequence translation scheme
+    ///
+    /// Required Functions:
+    ///
+    /// - std::size_t count() const
+    ///
+    /// - ScalarTranslationScheme at(std::size_t) const;
+    ///
+    /// Entries returned by 'at' may be used concurrently from multiple
+    /// threads, so they must not share mutable state.
+    ///
+    /// \tparam Translator the translation scheme to check
+    /// \tparam BoolT      the type to use for boolean types
+    /// \tparam IntT       the type to use for integral types
+    /// \tparam FloatT     the type to use for floating point types
+    /// \tparam StringT    the type to use for string types
+    /// \tparam KeyStringT the type to use for key strings
+    //////////////////////////////////////////////////////////////////////////
+    template<
+      typename Translator,
+      typename BoolT,
+      typename IntT,
+      typename FloatT,
+      typename StringT,
+      typename KeyStringT
+    >
+    struct RandomAccessSequenceTranslationScheme
+    {
+      constexpr RandomAccessSequenceTranslationScheme() : entry_validation(){}
+
+      static_assert(RandomAccessSequenceTranslationScheme_count<Translator>::value,"RandomAccessSequenceTranslationScheme concept requires const function 'count()' to return a type convertible to std::size_t");
+      static_assert(RandomAccessSequenceTranslationScheme_at<Translator>::value,"RandomAccessSequenceTranslationScheme concept requires const function 'at(std::size_t)' to return a ScalarTranslationScheme");
+
+      typedef typename std::decay<decltype(std::declval<const Translator>().at(std::declval<std::size_t>()))>::type entry_type;
+
+      ScalarTranslationScheme<entry_type,BoolT,IntT,FloatT,StringT,KeyStringT> entry_validation;
+    };
+
   } // namespace concepts
 } // namespace serial
 
@@ -178,6 +178,232 @@ namespace serial {
 
     //------------------------------------------------------------------------
 
+    template<typename Translator, typename BoolT, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_try_as_bool : std::false_type{};
+
+    template<typename T, typename BoolT, typename KeyStringT>
+    struct ScalarTranslationScheme_try_as_bool<
+      T,
+      BoolT,
+      KeyStringT,
+      void_t<
+        typename std::enable_if<std::is_convertible<
+          decltype(std::declval<const T>().try_as_bool(std::declval<KeyStringT>(),std::declval<BoolT&>())),
+          bool
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename IntT, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_try_as_int : std::false_type{};
+
+    template<typename T, typename IntT, typename KeyStringT>
+    struct ScalarTranslationScheme_try_as_int<
+      T,
+      IntT,
+      KeyStringT,
+      void_t<
+        typename std::enable_if<std::is_convertible<
+          decltype(std::declval<const T>().try_as_int(std::declval<KeyStringT>(),std::declval<IntT&>())),
+          bool
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename FloatT, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_try_as_float : std::false_type{};
+
+    template<typename T, typename FloatT, typename KeyStringT>
+    struct ScalarTranslationScheme_try_as_float<
+      T,
+      FloatT,
+      KeyStringT,
+      void_t<
+        typename std::enable_if<std::is_convertible<
+          decltype(std::declval<const T>().try_as_float(std::declval<KeyStringT>(),std::declval<FloatT&>())),
+          bool
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename StringT, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_try_as_string : std::false_type{};
+
+    template<typename T, typename StringT, typename KeyStringT>
+    struct ScalarTranslationScheme_try_as_string<
+      T,
+      StringT,
+      KeyStringT,
+      void_t<
+        typename std::enable_if<std::is_convertible<
+          decltype(std::declval<const T>().try_as_string(std::declval<KeyStringT>(),std::declval<StringT&>())),
+          bool
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename BoolT, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_try_as_bool_span : std::false_type{};
+
+    template<typename T, typename BoolT, typename KeyStringT>
+    struct ScalarTranslationScheme_try_as_bool_span<
+      T,
+      BoolT,
+      KeyStringT,
+      void_t<
+        typename std::enable_if<std::is_convertible<
+          decltype(std::declval<const T>().try_as_bool_span(std::declval<KeyStringT>(),std::declval<const BoolT*&>(),std::declval<std::size_t&>())),
+          bool
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename IntT, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_try_as_int_span : std::false_type{};
+
+    template<typename T, typename IntT, typename KeyStringT>
+    struct ScalarTranslationScheme_try_as_int_span<
+      T,
+      IntT,
+      KeyStringT,
+      void_t<
+        typename std::enable_if<std::is_convertible<
+          decltype(std::declval<const T>().try_as_int_span(std::declval<KeyStringT>(),std::declval<const IntT*&>(),std::declval<std::size_t&>())),
+          bool
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename FloatT, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_try_as_float_span : std::false_type{};
+
+    template<typename T, typename FloatT, typename KeyStringT>
+    struct ScalarTranslationScheme_try_as_float_span<
+      T,
+      FloatT,
+      KeyStringT,
+      void_t<
+        typename std::enable_if<std::is_convertible<
+          decltype(std::declval<const T>().try_as_float_span(std::declval<KeyStringT>(),std::declval<const FloatT*&>(),std::declval<std::size_t&>())),
+          bool
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename StringT, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_try_as_string_span : std::false_type{};
+
+    template<typename T, typename StringT, typename KeyStringT>
+    struct ScalarTranslationScheme_try_as_string_span<
+      T,
+      StringT,
+      KeyStringT,
+      void_t<
+        typename std::enable_if<std::is_convertible<
+          decltype(std::declval<const T>().try_as_string_span(std::declval<KeyStringT>(),std::declval<const StringT*&>(),std::declval<std::size_t&>())),
+          bool
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_prepare : std::false_type{};
+
+    template<typename T, typename KeyStringT>
+    struct ScalarTranslationScheme_prepare<
+      T,
+      KeyStringT,
+      void_t<
+        typename std::enable_if<!std::is_void<
+          decltype(std::declval<const T>().prepare(std::declval<KeyStringT>()))
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename StringViewT, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_as_string_view : std::false_type{};
+
+    template<typename T, typename StringViewT, typename KeyStringT>
+    struct ScalarTranslationScheme_as_string_view<
+      T,
+      StringViewT,
+      KeyStringT,
+      void_t<
+        typename std::enable_if<std::is_convertible<
+          decltype(std::declval<const T>().as_string_view(std::declval<KeyStringT>())),
+          StringViewT
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename StringViewT, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_as_string_view_sequence : std::false_type{};
+
+    template<typename T, typename StringViewT, typename KeyStringT>
+    struct ScalarTranslationScheme_as_string_view_sequence<
+      T,
+      StringViewT,
+      KeyStringT,
+      void_t<
+        decltype(std::declval<const T>().as_string_view_sequence(std::declval<KeyStringT>(),std::declval<void(*)(const StringViewT&)>()))
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_child : std::false_type{};
+
+    template<typename T, typename KeyStringT>
+    struct ScalarTranslationScheme_child<
+      T,
+      KeyStringT,
+      void_t<
+        typename std::enable_if<!std::is_void<
+          decltype(std::declval<const T>().child(std::declval<KeyStringT>()))
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename KeyStringT, typename = void>
+    struct ScalarTranslationScheme_as_sequence : std::false_type{};
+
+    template<typename T, typename KeyStringT>
+    struct ScalarTranslationScheme_as_sequence<
+      T,
+      KeyStringT,
+      void_t<
+        typename std::enable_if<std::is_convertible<
+          decltype(std::declval<const T>().as_sequence(std::declval<KeyStringT>()).count()),
+          std::size_t
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
     template<typename Translator, typename = void>
     struct SequenceTranslationScheme_next : std::false_type{};
 
@@ -192,6 +418,49 @@ namespace serial {
       >
     > : std::true_type{};
 
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename = void>
+    struct RandomAccessSequenceTranslationScheme_count : std::false_type{};
+
+    template<typename T>
+    struct RandomAccessSequenceTranslationScheme_count<
+      T,
+      void_t<
+        typename std::enable_if<std::is_convertible<
+          decltype(std::declval<const T>().count()),
+          std::size_t
+        >::value>::type
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename = void>
+    struct RandomAccessSequenceTranslationScheme_at : std::false_type{};
+
+    template<typename T>
+    struct RandomAccessSequenceTranslationScheme_at<
+      T,
+      void_t<
+        decltype(std::declval<const T>().at(std::declval<std::size_t>()))
+      >
+    > : std::true_type{};
+
+    //------------------------------------------------------------------------
+
+    template<typename Translator, typename KeyStringT, typename = void>
+    struct PullTranslationScheme_for_each_key : std::false_type{};
+
+    template<typename T, typename KeyStringT>
+    struct PullTranslationScheme_for_each_key<
+      T,
+      KeyStringT,
+      void_t<
+        decltype(std::declval<const T>().for_each_key(std::declval<void(*)(const KeyStringT&)>()))
+      >
+    > : std::true_type{};
+
   } // namespace concepts
 } // namespace serial
 
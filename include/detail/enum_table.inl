@@ -0,0 +1,169 @@
+#ifndef DATATRANSLATOR_DETAIL_ENUM_TABLE_INL_
+#define DATATRANSLATOR_DETAIL_ENUM_TABLE_INL_
+
+#include "key.inl"
+#include "perfect_hash.inl"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace serial {
+  namespace detail {
+
+    //------------------------------------------------------------------------
+    // Enum Tables
+    //------------------------------------------------------------------------
+
+    /// \brief Parses the decimal integer in \p text
+    ///
+    /// \param text  the characters to parse
+    /// \param value the parsed value
+    /// \return \c true if \p text is an optionally signed decimal integer of
+    ///         at most 18 digits
+    template<typename Text>
+    inline bool parse_enum_code( const Text& text, std::int64_t& value ) noexcept
+    {
+      const auto range = make_key_range(text);
+
+      typedef typename std::remove_cv<typename std::remove_reference<decltype(*range.data())>::type>::type char_type;
+
+      auto first = range.begin();
+      const bool negative = (first != range.end() && *first == char_type('-'));
+      if(negative) ++first;
+
+      const auto digits = static_cast<std::size_t>(range.end() - first);
+      if(digits == 0 || digits > 18) return false;
+
+      std::int64_t result = 0;
+      for( ; first != range.end(); ++first )
+      {
+        if(*first < char_type('0') || *first > char_type('9')) return false;
+        result = result * 10 + static_cast<std::int64_t>(*first - char_type('0'));
+      }
+      value = negative ? -result : result;
+      return true;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A lookup table from the names of the values of an enum to their
+    ///        underlying values
+    ///
+    /// Names are found through a minimal perfect hash, so a lookup hashes the
+    /// name once and compares it to a single candidate. Integer-coded input
+    /// is accepted when it is the value of one of the names.
+    ///
+    /// The enum itself is only written through a function instantiated for
+    /// its type, so that the table does not depend on it.
+    //////////////////////////////////////////////////////////////////////////
+    template<typename StringT>
+    class enum_table
+    {
+    public:
+
+      /// Writes \p value into the enum \p member
+      typedef void (*assign_function)( void* member, std::int64_t value );
+
+      /// \brief Builds the table of \p mapping
+      ///
+      /// When a name appears more than once, its last value is used.
+      ///
+      /// \param mapping  the name and underlying value of each enumerator
+      /// \param assigner the function that writes a value to the member
+      enum_table( std::vector<std::pair<StringT,std::int64_t>> mapping,
+                  assign_function assigner )
+        : m_names(),
+          m_values(),
+          m_codes(),
+          m_hash(),
+          m_assign(assigner)
+      {
+        typedef std::pair<StringT,std::int64_t> value_type;
+
+        std::stable_sort( mapping.begin(), mapping.end(), [](const value_type& lhs, const value_type& rhs)
+        {
+          return lhs.first < rhs.first;
+        });
+
+        std::vector<const StringT*> names;
+        std::vector<std::int64_t>   values;
+        for( const auto& entry : mapping )
+        {
+          if(!names.empty() && *names.back() == entry.first)
+          {
+            values.back() = entry.second;
+            continue;
+          }
+          names.push_back( &entry.first );
+          values.push_back( entry.second );
+        }
+
+        const auto slots = m_hash.build(names);
+
+        m_names.resize(names.size());
+        m_values.resize(names.size());
+        for( std::size_t i = 0; i < names.size(); ++i )
+        {
+          m_names[slots[i]]  = *names[i];
+          m_values[slots[i]] = values[i];
+        }
+
+        m_codes = values;
+        std::sort( m_codes.begin(), m_codes.end() );
+      }
+
+      /// \brief Finds the value named by \p text
+      ///
+      /// \param text  the name of the value, or its integer code
+      /// \param value the value that was found
+      /// \return \c true if \p text names, or codes, a value of the table
+      template<typename Text>
+      bool find( const Text& text, std::int64_t& value ) const noexcept
+      {
+        if(!m_names.empty())
+        {
+          const auto slot = m_hash.slot(text);
+          if(key_equal(m_names[slot], text))
+          {
+            value = m_values[slot];
+            return true;
+          }
+        }
+        return parse_enum_code(text, value) &&
+               std::binary_search( m_codes.begin(), m_codes.end(), value );
+      }
+
+      /// \brief Writes \p value into the enum \p member
+      void assign( void* member, std::int64_t value ) const
+      {
+        m_assign( member, value );
+      }
+
+      /// \brief Gets the number of names in the table
+      std::size_t size() const noexcept
+      {
+        return m_names.size();
+      }
+
+    private:
+
+      std::vector<StringT>      m_names;  ///< The name at each slot of the hash
+      std::vector<std::int64_t> m_values; ///< The value at each slot of the hash
+      std::vector<std::int64_t> m_codes;  ///< Every value, sorted
+      perfect_hash              m_hash;   ///< Perfect hash of the names
+      assign_function           m_assign; ///< Writes a value into the member
+    };
+
+    template<typename Enum>
+    inline void assign_enum( void* member, std::int64_t value )
+    {
+      *static_cast<Enum*>(member) = static_cast<Enum>(value);
+    }
+
+  } // namespace detail
+} // namespace serial
+
+#endif /* DATATRANSLATOR_DETAIL_ENUM_TABLE_INL_ */
@@ -0,0 +1,225 @@
+#ifndef DATATRANSLATOR_DETAIL_KEY_INL_
+#define DATATRANSLATOR_DETAIL_KEY_INL_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace serial {
+  namespace detail {
+
+    //------------------------------------------------------------------------
+    // Key Ranges
+    //------------------------------------------------------------------------
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A non-owning view of the characters of a key
+    ///
+    /// Key ranges let keys of different string types be hashed and compared
+    /// against the stored keys without converting, or allocating, a
+    /// key string.
+    //////////////////////////////////////////////////////////////////////////
+    template<typename CharT>
+    struct key_range
+    {
+      const CharT* first; ///< The first character of the key
+      const CharT* last;  ///< One past the last character of the key
+
+      const CharT* begin() const noexcept{ return first; }
+      const CharT* end() const noexcept{ return last; }
+      const CharT* data() const noexcept{ return first; }
+      std::size_t  size() const noexcept{ return static_cast<std::size_t>(last - first); }
+    };
+
+    /// \brief Gets the key range of a null-terminated character string
+    template<typename CharT>
+    inline key_range<CharT> make_key_range( const CharT* key ) noexcept
+    {
+      return { key, key + std::char_traits<CharT>::length(key) };
+    }
+
+    /// \brief Gets the key range of any contiguous string with \c data() and
+    ///        \c size(), such as std::basic_string or a string view
+    template<typename KeyStringT>
+    inline auto make_key_range( const KeyStringT& key ) noexcept
+      -> key_range<typename std::remove_cv<typename std::remove_reference<decltype(*key.data())>::type>::type>
+    {
+      return { key.data(), key.data() + key.size() };
+    }
+
+    /// \brief Compares the characters of two keys of any string type
+    ///
+    /// \param lhs the first key
+    /// \param rhs the second key
+    /// \return \c true if both keys contain the same characters
+    template<typename LeftKey, typename RightKey>
+    inline bool key_equal( const LeftKey& lhs, const RightKey& rhs ) noexcept
+    {
+      const auto left  = make_key_range(lhs);
+      const auto right = make_key_range(rhs);
+
+      typedef typename std::remove_cv<typename std::remove_reference<decltype(*left.data())>::type>::type char_type;
+
+      return left.size() == right.size() &&
+             std::char_traits<char_type>::compare(left.data(), right.data(), left.size()) == 0;
+    }
+
+    //------------------------------------------------------------------------
+    // Key Tables
+    //------------------------------------------------------------------------
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A table of keys interned into a single contiguous buffer
+    ///
+    /// Every key starts on a 16 byte boundary of the buffer and is padded
+    /// with null characters up to the next boundary, so that keys can be
+    /// compared a whole block at a time and are always null-terminated.
+    //////////////////////////////////////////////////////////////////////////
+    template<typename CharT>
+    class key_table
+    {
+    public:
+
+      /// The number of characters in a block of the table
+      static constexpr std::size_t block_size = (sizeof(CharT) < 16) ? (16 / sizeof(CharT)) : 1;
+
+      /// \brief Appends the \p size characters of \p key to the table
+      ///
+      /// \param key  the characters of the key
+      /// \param size the number of characters in \p key
+      /// \return the offset of the key in the table
+      std::size_t add( const CharT* key, std::size_t size )
+      {
+        const std::size_t offset = m_chars.size();
+        const std::size_t blocks = size / block_size + 1;
+
+        m_chars.resize( offset + blocks * block_size, CharT() );
+        std::char_traits<CharT>::copy( m_chars.data() + offset, key, size );
+        return offset;
+      }
+
+      /// \brief Gets the characters of the key at \p offset
+      const CharT* data( std::size_t offset ) const noexcept
+      {
+        return m_chars.data() + offset;
+      }
+
+      /// \brief Checks whether the key of \p size characters at \p offset
+      ///        is \p key
+      template<typename Key>
+      bool equal( std::size_t offset, std::size_t size, const Key& key ) const noexcept
+      {
+        const auto range = make_key_range(key);
+        return range.size() == size &&
+               std::char_traits<CharT>::compare(m_chars.data() + offset, range.data(), size) == 0;
+      }
+
+      /// \brief Gets the number of characters in the table, including padding
+      std::size_t size() const noexcept
+      {
+        return m_chars.size();
+      }
+
+      /// \brief Removes every key from the table
+      void clear() noexcept
+      {
+        m_chars.clear();
+      }
+
+      /// \brief Releases the unused capacity of the table
+      void shrink_to_fit()
+      {
+        m_chars.shrink_to_fit();
+      }
+
+    private:
+
+      std::vector<CharT> m_chars; ///< The padded keys
+    };
+
+    template<typename CharT>
+    constexpr std::size_t key_table<CharT>::block_size;
+
+    //------------------------------------------------------------------------
+    // Key Hashing
+    //------------------------------------------------------------------------
+
+    constexpr std::uint64_t key_hash_basis = 14695981039346656037ull; ///< FNV-1a offset basis
+    constexpr std::uint64_t key_hash_prime = 1099511628211ull;        ///< FNV-1a prime
+
+    /// \brief Hashes the null-terminated string \p key with FNV-1a at
+    ///        compile time
+    ///
+    /// This produces the same hash as #hash_key with no salt.
+    ///
+    /// \param key  the key to hash
+    /// \param hash the hash of the characters preceding \p key
+    /// \return the hash of the key
+    template<typename CharT>
+    constexpr std::uint64_t hash_literal( const CharT* key,
+                                          std::uint64_t hash = key_hash_basis ) noexcept
+    {
+      return (*key == CharT())
+        ? hash
+        : hash_literal( key + 1,
+                        (hash ^ static_cast<std::uint64_t>(static_cast<typename std::make_unsigned<CharT>::type>(*key))) * key_hash_prime );
+    }
+
+    template<typename Key, typename = void>
+    struct has_key_hash : std::false_type{};
+
+    template<typename Key>
+    struct has_key_hash<
+      Key,
+      typename std::enable_if<std::is_convertible<
+        decltype(std::declval<const Key&>().hash()),
+        std::uint64_t
+      >::value>::type
+    > : std::true_type{};
+
+    template<typename KeyStringT>
+    inline std::uint64_t hash_key( const KeyStringT& key,
+                                   std::uint64_t salt,
+                                   std::false_type ) noexcept
+    {
+      std::uint64_t hash = key_hash_basis ^ salt;
+      for( auto c : make_key_range(key) )
+      {
+        typedef typename std::make_unsigned<decltype(c)>::type unsigned_type;
+        hash = (hash ^ static_cast<std::uint64_t>(static_cast<unsigned_type>(c))) * key_hash_prime;
+      }
+      return hash;
+    }
+
+    template<typename KeyStringT>
+    inline std::uint64_t hash_key( const KeyStringT& key,
+                                   std::uint64_t salt,
+                                   std::true_type ) noexcept
+    {
+      // Keys that carry their own hash only need rehashing when salted
+      if(salt == 0) return key.hash();
+      return hash_key( key, salt, std::false_type() );
+    }
+
+    /// \brief Hashes the characters of \p key with FNV-1a, starting from
+    ///        \p salt
+    ///
+    /// Keys with a \c hash() function, such as \c serial::basic_hashed_key,
+    /// are assumed to already hold their unsalted hash.
+    ///
+    /// \param key  the key to hash; a character string, or any contiguous
+    ///             string with \c data() and \c size()
+    /// \param salt the value to perturb the hash with
+    /// \return the hash of the key
+    template<typename KeyStringT>
+    inline std::uint64_t hash_key( const KeyStringT& key, std::uint64_t salt = 0 ) noexcept
+    {
+      return hash_key( key, salt, has_key_hash<KeyStringT>() );
+    }
+
+  } // namespace detail
+} // namespace serial
+
+#endif /* DATATRANSLATOR_DETAIL_KEY_INL_ */
@@ -0,0 +1,170 @@
+#ifndef DATATRANSLATOR_DETAIL_PERFECT_HASH_INL_
+#define DATATRANSLATOR_DETAIL_PERFECT_HASH_INL_
+
+#include "key.inl"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace serial {
+  namespace detail {
+
+    //------------------------------------------------------------------------
+    // Hash Mixing
+    //------------------------------------------------------------------------
+
+    /// \brief Mixes \p hash with \p seed to produce a well distributed value
+    inline std::uint64_t mix_hash( std::uint64_t hash, std::uint64_t seed ) noexcept
+    {
+      std::uint64_t z = hash + seed * 0x9e3779b97f4a7c15ull;
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+      return z ^ (z >> 31);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A minimal perfect hash over a set of distinct keys, generated
+    ///        at runtime with the hash-and-displace method
+    ///
+    /// Keys are first hashed into buckets, and each bucket is assigned the
+    /// first seed that maps all of its keys onto free slots. Every key of the
+    /// set maps to a unique slot in [0,size()); keys outside of the set map
+    /// to an arbitrary slot, so the caller must compare the key stored at the
+    /// slot to confirm a match.
+    //////////////////////////////////////////////////////////////////////////
+    class perfect_hash
+    {
+    public:
+
+      /// \brief Builds the hash over \p keys
+      ///
+      /// \param keys the distinct keys to hash
+      /// \return the slot of each key, in the order of \p keys
+      template<typename KeyStringT>
+      std::vector<std::size_t> build( const std::vector<const KeyStringT*>& keys )
+      {
+        m_size = keys.size();
+        m_seeds.clear();
+        m_salt = 0;
+
+        std::vector<std::size_t> slots(m_size);
+        if(m_size == 0) return slots;
+
+        m_seeds.resize(m_size / 2 + 1);
+
+        std::vector<std::uint64_t> hashes(m_size);
+        for(;;)
+        {
+          for( std::size_t i = 0; i < m_size; ++i )
+          {
+            hashes[i] = hash_key(*keys[i], m_salt);
+          }
+          if(place(hashes, slots)) break;
+
+          // Distinct keys whose hashes fully collide can never be separated
+          // by a seed, so retry with a different salt
+          ++m_salt;
+        }
+        return slots;
+      }
+
+      /// \brief Gets the candidate slot of \p key
+      ///
+      /// \param key the key to look up
+      /// \return the slot of \p key if it is in the set
+      template<typename KeyStringT>
+      std::size_t slot( const KeyStringT& key ) const noexcept
+      {
+        const std::uint64_t hash = hash_key(key, m_salt);
+        const std::uint32_t seed = m_seeds[static_cast<std::size_t>(hash % m_seeds.size())];
+        return static_cast<std::size_t>(mix_hash(hash, seed) % m_size);
+      }
+
+      /// \brief Gets the number of keys in the set
+      std::size_t size() const noexcept
+      {
+        return m_size;
+      }
+
+    private:
+
+      /// \brief Assigns a seed to every bucket
+      ///
+      /// \param hashes the hashes of the keys
+      /// \param slots  the slot of each key, to be populated
+      /// \return \c true if every bucket was assigned a seed
+      bool place( const std::vector<std::uint64_t>& hashes,
+                  std::vector<std::size_t>& slots )
+      {
+        const std::size_t buckets = m_seeds.size();
+
+        std::vector<std::vector<std::size_t>> members(buckets);
+        for( std::size_t i = 0; i < hashes.size(); ++i )
+        {
+          members[static_cast<std::size_t>(hashes[i] % buckets)].push_back(i);
+        }
+
+        // Place the largest buckets first, while most slots are still free
+        std::vector<std::size_t> order(buckets);
+        for( std::size_t i = 0; i < buckets; ++i ) order[i] = i;
+        std::sort( order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs)
+        {
+          return members[lhs].size() > members[rhs].size();
+        });
+
+        // The last buckets to be placed only have a few free slots left, so
+        // the number of seeds to try before changing salt grows with the set
+        const std::uint64_t max_seed = std::min<std::uint64_t>( 0xffffffffull,
+                                                                std::max<std::uint64_t>( 1u << 16, 16ull * m_size ) );
+
+        std::vector<bool>        occupied(m_size,false);
+        std::vector<std::size_t> candidates;
+
+        for( auto bucket : order )
+        {
+          const auto& keys = members[bucket];
+          m_seeds[bucket] = 0;
+          if(keys.empty()) continue;
+
+          std::uint32_t seed = 0;
+          for(;;)
+          {
+            if(++seed == max_seed) return false;
+
+            candidates.clear();
+            bool placed = true;
+            for( auto key : keys )
+            {
+              const auto slot = static_cast<std::size_t>(mix_hash(hashes[key], seed) % m_size);
+              if(occupied[slot] || std::find(candidates.begin(), candidates.end(), slot) != candidates.end())
+              {
+                placed = false;
+                break;
+              }
+              candidates.push_back(slot);
+            }
+            if(placed) break;
+          }
+
+          m_seeds[bucket] = seed;
+          for( std::size_t i = 0; i < keys.size(); ++i )
+          {
+            occupied[candidates[i]] = true;
+            slots[keys[i]] = candidates[i];
+          }
+        }
+        return true;
+      }
+
+      std::vector<std::uint32_t> m_seeds;    ///< The seed of each bucket
+      std::size_t                m_size = 0; ///< The number of keys
+      std::uint64_t              m_salt = 0; ///< The salt of the key hash
+    };
+
+  } // namespace detail
+} // namespace serial
+
+#endif /* DATATRANSLATOR_DETAIL_PERFECT_HASH_INL_ */
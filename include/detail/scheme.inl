@@ -0,0 +1,621 @@
+#ifndef DATATRANSLATOR_DETAIL_SCHEME_INL_
+#define DATATRANSLATOR_DETAIL_SCHEME_INL_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace serial {
+  namespace detail {
+
+    // Scheme accessors that prefer the optional capabilities of a translation
+    // scheme when it provides them, and fall back on the required functions
+    // otherwise.
+
+    //------------------------------------------------------------------------
+    // Prepared Keys
+    //------------------------------------------------------------------------
+
+    /// \brief The type of handle that a scheme prepares from a key
+    template<typename TranslationScheme, typename KeyStringT>
+    using prepared_key_t = typename std::decay<
+      decltype(std::declval<const TranslationScheme>().prepare(std::declval<KeyStringT>()))
+    >::type;
+
+    /// \brief The type of scheme that a scheme returns for a child node
+    template<typename TranslationScheme, typename KeyStringT>
+    using child_scheme_t = typename std::decay<
+      decltype(std::declval<const TranslationScheme>().child(std::declval<KeyStringT>()))
+    >::type;
+
+    template<typename T>
+    struct type_tag{ static const char id; };
+
+    template<typename T>
+    const char type_tag<T>::id = 0;
+
+    /// \brief Gets a unique identifier for the type \p T, without RTTI
+    template<typename T>
+    inline const void* type_id() noexcept
+    {
+      return &type_tag<T>::id;
+    }
+
+    //------------------------------------------------------------------------
+    // Scalars
+    //------------------------------------------------------------------------
+
+    template<typename TranslationScheme, typename KeyStringT, typename BoolT>
+    inline bool read_bool( const TranslationScheme& data,
+                           const KeyStringT& key,
+                           BoolT& out,
+                           std::true_type )
+    {
+      return data.try_as_bool(key,out);
+    }
+
+    template<typename TranslationScheme, typename KeyStringT, typename BoolT>
+    inline bool read_bool( const TranslationScheme& data,
+                           const KeyStringT& key,
+                           BoolT& out,
+                           std::false_type )
+    {
+      if(!data.has(key)) return false;
+
+      out = data.as_bool(key);
+      return true;
+    }
+
+    /// \brief Reads the bool with the given \p key into \p out, using the
+    ///        fused 'try_as_bool' of the scheme when it is available
+    ///
+    /// \param data the scheme to read from
+    /// \param key  the key of the entry
+    /// \param out  the value to write to
+    /// \return \c true if the entry exists and was read into \p out
+    template<typename TranslationScheme, typename KeyStringT, typename BoolT>
+    inline bool read_bool( const TranslationScheme& data,
+                           const KeyStringT& key,
+                           BoolT& out )
+    {
+      return read_bool( data, key, out, concepts::ScalarTranslationScheme_try_as_bool<TranslationScheme,BoolT,KeyStringT>() );
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename TranslationScheme, typename KeyStringT, typename IntT>
+    inline bool read_int( const TranslationScheme& data,
+                          const KeyStringT& key,
+                          IntT& out,
+                          std::true_type )
+    {
+      return data.try_as_int(key,out);
+    }
+
+    template<typename TranslationScheme, typename KeyStringT, typename IntT>
+    inline bool read_int( const TranslationScheme& data,
+                          const KeyStringT& key,
+                          IntT& out,
+                          std::false_type )
+    {
+      if(!data.has(key)) return false;
+
+      out = data.as_int(key);
+      return true;
+    }
+
+    /// \brief Reads the int with the given \p key into \p out, using the
+    ///        fused 'try_as_int' of the scheme when it is available
+    ///
+    /// \param data the scheme to read from
+    /// \param key  the key of the entry
+    /// \param out  the value to write to
+    /// \return \c true if the entry exists and was read into \p out
+    template<typename TranslationScheme, typename KeyStringT, typename IntT>
+    inline bool read_int( const TranslationScheme& data,
+                          const KeyStringT& key,
+                          IntT& out )
+    {
+      return read_int( data, key, out, concepts::ScalarTranslationScheme_try_as_int<TranslationScheme,IntT,KeyStringT>() );
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename TranslationScheme, typename KeyStringT, typename FloatT>
+    inline bool read_float( const TranslationScheme& data,
+                            const KeyStringT& key,
+                            FloatT& out,
+                            std::true_type )
+    {
+      return data.try_as_float(key,out);
+    }
+
+    template<typename TranslationScheme, typename KeyStringT, typename FloatT>
+    inline bool read_float( const TranslationScheme& data,
+                            const KeyStringT& key,
+                            FloatT& out,
+                            std::false_type )
+    {
+      if(!data.has(key)) return false;
+
+      out = data.as_float(key);
+      return true;
+    }
+
+    /// \brief Reads the float with the given \p key into \p out, using the
+    ///        fused 'try_as_float' of the scheme when it is available
+    ///
+    /// \param data the scheme to read from
+    /// \param key  the key of the entry
+    /// \param out  the value to write to
+    /// \return \c true if the entry exists and was read into \p out
+    template<typename TranslationScheme, typename KeyStringT, typename FloatT>
+    inline bool read_float( const TranslationScheme& data,
+                            const KeyStringT& key,
+                            FloatT& out )
+    {
+      return read_float( data, key, out, concepts::ScalarTranslationScheme_try_as_float<TranslationScheme,FloatT,KeyStringT>() );
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename TranslationScheme, typename KeyStringT, typename StringT>
+    inline bool read_string( const TranslationScheme& data,
+                             const KeyStringT& key,
+                             StringT& out,
+                             std::true_type )
+    {
+      return data.try_as_string(key,out);
+    }
+
+    template<typename TranslationScheme, typename KeyStringT, typename StringT>
+    inline bool read_string( const TranslationScheme& data,
+                             const KeyStringT& key,
+                             StringT& out,
+                             std::false_type )
+    {
+      if(!data.has(key)) return false;
+
+      out = data.as_string(key);
+      return true;
+    }
+
+    /// \brief Reads the string with the given \p key into \p out, using the
+    ///        fused 'try_as_string' of the scheme when it is available
+    ///
+    /// \param data the scheme to read from
+    /// \param key  the key of the entry
+    /// \param out  the value to write to
+    /// \return \c true if the entry exists and was read into \p out
+    template<typename TranslationScheme, typename KeyStringT, typename StringT>
+    inline bool read_string( const TranslationScheme& data,
+                             const KeyStringT& key,
+                             StringT& out )
+    {
+      return read_string( data, key, out, concepts::ScalarTranslationScheme_try_as_string<TranslationScheme,StringT,KeyStringT>() );
+    }
+
+
+    //------------------------------------------------------------------------
+    // Sequences
+    //------------------------------------------------------------------------
+
+    /// \brief Writes elements into a vector, either appending to it or
+    ///        overwriting it in place
+    ///
+    /// When overwriting, existing elements are assigned to rather than
+    /// destroyed, so that the vector and its elements keep their capacity.
+    template<typename Vector>
+    class sequence_writer
+    {
+    public:
+      typedef typename Vector::value_type value_type;
+
+      sequence_writer( Vector& out, bool replace )
+        : m_out(out),
+          m_index(replace ? 0 : out.size())
+      {
+
+      }
+
+      void operator()( const value_type& value )
+      {
+        if(m_index < m_out.size())
+        {
+          m_out[m_index] = value;
+        }
+        else
+        {
+          m_out.push_back(value);
+        }
+        ++m_index;
+      }
+
+      /// \brief Removes any elements that were not overwritten
+      void finish()
+      {
+        m_out.erase( m_out.begin() + static_cast<std::ptrdiff_t>(m_index), m_out.end() );
+      }
+
+    private:
+      Vector&     m_out;
+      std::size_t m_index;
+    };
+
+    template<typename Vector, typename T>
+    inline void write_span( Vector& out,
+                            const T* first,
+                            std::size_t size,
+                            bool replace )
+    {
+      if(replace)
+      {
+        out.assign( first, first + size );
+      }
+      else
+      {
+        out.insert( out.end(), first, first + size );
+      }
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_bool_sequence( const TranslationScheme& data,
+                                    const KeyStringT& key,
+                                    Vector& out,
+                                    bool replace,
+                                    std::true_type )
+    {
+      const typename Vector::value_type* first = nullptr;
+      std::size_t size = 0;
+
+      if(!data.try_as_bool_span(key,first,size)) return false;
+
+      write_span( out, first, size, replace );
+      return true;
+    }
+
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_bool_sequence( const TranslationScheme& data,
+                                    const KeyStringT& key,
+                                    Vector& out,
+                                    bool replace,
+                                    std::false_type )
+    {
+      if(!data.has(key)) return false;
+
+      sequence_writer<Vector> writer( out, replace );
+
+      out.reserve((replace ? 0 : out.size()) + data.size(key));
+      data.template as_bool_sequence(key, [&](const typename Vector::value_type& value)
+      {
+        writer(value);
+      });
+      writer.finish();
+      return true;
+    }
+
+    /// \brief Reads the bool sequence with the given \p key into \p out,
+    ///        copying it in bulk when the scheme provides 'try_as_bool_span'
+    ///
+    /// \param data    the scheme to read from
+    /// \param key     the key of the entry
+    /// \param out     the vector to write to
+    /// \param replace whether to replace the contents of \p out rather than
+    ///                append to it
+    /// \return \c true if the entry exists and was written to \p out
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_bool_sequence( const TranslationScheme& data,
+                                    const KeyStringT& key,
+                                    Vector& out,
+                                    bool replace )
+    {
+      return read_bool_sequence( data, key, out, replace, concepts::ScalarTranslationScheme_try_as_bool_span<TranslationScheme,typename Vector::value_type,KeyStringT>() );
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_int_sequence( const TranslationScheme& data,
+                                   const KeyStringT& key,
+                                   Vector& out,
+                                   bool replace,
+                                   std::true_type )
+    {
+      const typename Vector::value_type* first = nullptr;
+      std::size_t size = 0;
+
+      if(!data.try_as_int_span(key,first,size)) return false;
+
+      write_span( out, first, size, replace );
+      return true;
+    }
+
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_int_sequence( const TranslationScheme& data,
+                                   const KeyStringT& key,
+                                   Vector& out,
+                                   bool replace,
+                                   std::false_type )
+    {
+      if(!data.has(key)) return false;
+
+      sequence_writer<Vector> writer( out, replace );
+
+      out.reserve((replace ? 0 : out.size()) + data.size(key));
+      data.template as_int_sequence(key, [&](const typename Vector::value_type& value)
+      {
+        writer(value);
+      });
+      writer.finish();
+      return true;
+    }
+
+    /// \brief Reads the int sequence with the given \p key into \p out,
+    ///        copying it in bulk when the scheme provides 'try_as_int_span'
+    ///
+    /// \param data    the scheme to read from
+    /// \param key     the key of the entry
+    /// \param out     the vector to write to
+    /// \param replace whether to replace the contents of \p out rather than
+    ///                append to it
+    /// \return \c true if the entry exists and was written to \p out
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_int_sequence( const TranslationScheme& data,
+                                   const KeyStringT& key,
+                                   Vector& out,
+                                   bool replace )
+    {
+      return read_int_sequence( data, key, out, replace, concepts::ScalarTranslationScheme_try_as_int_span<TranslationScheme,typename Vector::value_type,KeyStringT>() );
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_float_sequence( const TranslationScheme& data,
+                                     const KeyStringT& key,
+                                     Vector& out,
+                                     bool replace,
+                                     std::true_type )
+    {
+      const typename Vector::value_type* first = nullptr;
+      std::size_t size = 0;
+
+      if(!data.try_as_float_span(key,first,size)) return false;
+
+      write_span( out, first, size, replace );
+      return true;
+    }
+
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_float_sequence( const TranslationScheme& data,
+                                     const KeyStringT& key,
+                                     Vector& out,
+                                     bool replace,
+                                     std::false_type )
+    {
+      if(!data.has(key)) return false;
+
+      sequence_writer<Vector> writer( out, replace );
+
+      out.reserve((replace ? 0 : out.size()) + data.size(key));
+      data.template as_float_sequence(key, [&](const typename Vector::value_type& value)
+      {
+        writer(value);
+      });
+      writer.finish();
+      return true;
+    }
+
+    /// \brief Reads the float sequence with the given \p key into \p out,
+    ///        copying it in bulk when the scheme provides 'try_as_float_span'
+    ///
+    /// \param data    the scheme to read from
+    /// \param key     the key of the entry
+    /// \param out     the vector to write to
+    /// \param replace whether to replace the contents of \p out rather than
+    ///                append to it
+    /// \return \c true if the entry exists and was written to \p out
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_float_sequence( const TranslationScheme& data,
+                                     const KeyStringT& key,
+                                     Vector& out,
+                                     bool replace )
+    {
+      return read_float_sequence( data, key, out, replace, concepts::ScalarTranslationScheme_try_as_float_span<TranslationScheme,typename Vector::value_type,KeyStringT>() );
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_string_sequence( const TranslationScheme& data,
+                                      const KeyStringT& key,
+                                      Vector& out,
+                                      bool replace,
+                                      std::true_type )
+    {
+      const typename Vector::value_type* first = nullptr;
+      std::size_t size = 0;
+
+      if(!data.try_as_string_span(key,first,size)) return false;
+
+      write_span( out, first, size, replace );
+      return true;
+    }
+
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_string_sequence( const TranslationScheme& data,
+                                      const KeyStringT& key,
+                                      Vector& out,
+                                      bool replace,
+                                      std::false_type )
+    {
+      if(!data.has(key)) return false;
+
+      sequence_writer<Vector> writer( out, replace );
+
+      out.reserve((replace ? 0 : out.size()) + data.size(key));
+      data.template as_string_sequence(key, [&](const typename Vector::value_type& value)
+      {
+        writer(value);
+      });
+      writer.finish();
+      return true;
+    }
+
+    /// \brief Reads the string sequence with the given \p key into \p out,
+    ///        copying it in bulk when the scheme provides 'try_as_string_span'
+    ///
+    /// \param data    the scheme to read from
+    /// \param key     the key of the entry
+    /// \param out     the vector to write to
+    /// \param replace whether to replace the contents of \p out rather than
+    ///                append to it
+    /// \return \c true if the entry exists and was written to \p out
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_string_sequence( const TranslationScheme& data,
+                                      const KeyStringT& key,
+                                      Vector& out,
+                                      bool replace )
+    {
+      return read_string_sequence( data, key, out, replace, concepts::ScalarTranslationScheme_try_as_string_span<TranslationScheme,typename Vector::value_type,KeyStringT>() );
+    }
+
+    //------------------------------------------------------------------------
+    // Borrowed Strings
+    //------------------------------------------------------------------------
+
+    template<typename TranslationScheme, typename KeyStringT, typename StringViewT>
+    inline bool read_string_view( const TranslationScheme& data,
+                                  const KeyStringT& key,
+                                  StringViewT& out,
+                                  std::true_type )
+    {
+      if(!data.has(key)) return false;
+
+      out = StringViewT(data.as_string_view(key));
+      return true;
+    }
+
+    template<typename TranslationScheme, typename KeyStringT, typename StringViewT>
+    inline bool read_string_view( const TranslationScheme&,
+                                  const KeyStringT&,
+                                  StringViewT&,
+                                  std::false_type )
+    {
+      return false;
+    }
+
+    /// \brief Reads a view of the string with the given \p key, borrowed from
+    ///        the document backing \p data, into \p out
+    ///
+    /// Schemes that do not provide 'as_string_view' cannot lend out their
+    /// strings, and leave \p out untouched.
+    ///
+    /// \param data the scheme to read from
+    /// \param key  the key of the entry
+    /// \param out  the view to write to
+    /// \return \c true if the entry exists and was viewed by \p out
+    template<typename TranslationScheme, typename KeyStringT, typename StringViewT>
+    inline bool read_string_view( const TranslationScheme& data,
+                                  const KeyStringT& key,
+                                  StringViewT& out )
+    {
+      return read_string_view( data, key, out, concepts::ScalarTranslationScheme_as_string_view<TranslationScheme,StringViewT,KeyStringT>() );
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_string_view_sequence( const TranslationScheme& data,
+                                           const KeyStringT& key,
+                                           Vector& out,
+                                           bool replace,
+                                           std::true_type )
+    {
+      if(!data.has(key)) return false;
+
+      sequence_writer<Vector> writer( out, replace );
+
+      out.reserve((replace ? 0 : out.size()) + data.size(key));
+      data.template as_string_view_sequence(key, [&](const typename Vector::value_type& value)
+      {
+        writer(value);
+      });
+      writer.finish();
+      return true;
+    }
+
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_string_view_sequence( const TranslationScheme&,
+                                           const KeyStringT&,
+                                           Vector&,
+                                           bool,
+                                           std::false_type )
+    {
+      return false;
+    }
+
+    /// \brief Reads views of the strings in the sequence with the given
+    ///        \p key, borrowed from the document backing \p data, into \p out
+    ///
+    /// \param data    the scheme to read from
+    /// \param key     the key of the entry
+    /// \param out     the vector to write to
+    /// \param replace whether to replace the contents of \p out rather than
+    ///                append to it
+    /// \return \c true if the entry exists and was written to \p out
+    template<typename TranslationScheme, typename KeyStringT, typename Vector>
+    inline bool read_string_view_sequence( const TranslationScheme& data,
+                                           const KeyStringT& key,
+                                           Vector& out,
+                                           bool replace )
+    {
+      return read_string_view_sequence( data, key, out, replace, concepts::ScalarTranslationScheme_as_string_view_sequence<TranslationScheme,typename Vector::value_type,KeyStringT>() );
+    }
+
+    //------------------------------------------------------------------------
+
+    template<typename StringViewT, typename TranslationScheme, typename KeyStringT, typename Func>
+    inline void for_each_string_view( const TranslationScheme& data,
+                                      const KeyStringT& key,
+                                      Func func,
+                                      std::true_type )
+    {
+      data.as_string_view_sequence(key, [&](const StringViewT& value)
+      {
+        func(value);
+      });
+    }
+
+    template<typename StringViewT, typename TranslationScheme, typename KeyStringT, typename Func>
+    inline void for_each_string_view( const TranslationScheme&,
+                                      const KeyStringT&,
+                                      Func,
+                                      std::false_type )
+    {
+
+    }
+
+    /// \brief Calls \p func with a view of each string in the sequence with
+    ///        the given \p key
+    ///
+    /// Schemes that do not provide 'as_string_view_sequence' never call
+    /// \p func.
+    ///
+    /// \param data the scheme to read from
+    /// \param key  the key of the entry
+    /// \param func the function to call with each view
+    template<typename StringViewT, typename TranslationScheme, typename KeyStringT, typename Func>
+    inline void for_each_string_view( const TranslationScheme& data,
+                                      const KeyStringT& key,
+                                      Func func )
+    {
+      for_each_string_view<StringViewT>( data, key, func, concepts::ScalarTranslationScheme_as_string_view_sequence<TranslationScheme,StringViewT,KeyStringT>() );
+    }
+
+  } // namespace detail
+} // namespace serial
+
+#endif /* DATATRANSLATOR_DETAIL_SCHEME_INL_ */
@@ -9,7 +9,10 @@
  */
 #include "catch.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <thread>
 #include <DataTranslator.hpp>
 
 #include "DummyTranslator.hpp"
@@ -29,6 +32,16 @@ struct ExampleClass
 
 typedef serial::DataTranslator<ExampleClass> ExampleTranslator;
 
+// Minimal string view, to check keys are looked up without conversion
+struct KeyView
+{
+  const char* first;
+  std::size_t length;
+
+  const char* data() const{ return first; }
+  std::size_t size() const{ return length; }
+};
+
 //----------------------------------------------------------------------------
 // Add Members
 //----------------------------------------------------------------------------
@@ -61,6 +74,20 @@ TEST_CASE("has_member") {
     translator.add_member("scalar.bool", &ExampleClass::bool_scalar);
     REQUIRE( translator.has_member("scalar.bool") == true );
   }
+
+  SECTION("DataTranslator has member named by a string view")
+  {
+    ExampleTranslator translator;
+    translator.add_member("scalar.bool", &ExampleClass::bool_scalar);
+
+    const char* name = "scalar.bool.unregistered";
+    REQUIRE( translator.has_member(KeyView{name, 11}) == true );
+    REQUIRE( translator.has_member(KeyView{name, 13}) == false );
+
+    translator.freeze();
+    REQUIRE( translator.has_member(KeyView{name, 11}) == true );
+    REQUIRE( translator.has_member(KeyView{name, 13}) == false );
+  }
 }
 
 // 'add_member' is an overload that calls into the verbose
@@ -257,3 +284,1223 @@ TEST_CASE("translate") {
   } // translates correct vector entries
 }
 
+
+//----------------------------------------------------------------------------
+// Plan Compilation
+//----------------------------------------------------------------------------
+
+TEST_CASE("freeze") {
+
+  SECTION("Default constructed DataTranslator is not frozen")
+  {
+    ExampleTranslator translator;
+    REQUIRE( translator.frozen() == false );
+  }
+
+  SECTION("freeze marks the DataTranslator as frozen")
+  {
+    ExampleTranslator translator;
+    translator.add_member("scalar.bool", &ExampleClass::bool_scalar).freeze();
+    REQUIRE( translator.frozen() == true );
+  }
+
+  SECTION("Adding a member after freezing discards the frozen state")
+  {
+    ExampleTranslator translator;
+    translator.add_member("scalar.bool", &ExampleClass::bool_scalar).freeze();
+    translator.add_member("scalar.int", &ExampleClass::int_scalar);
+    REQUIRE( translator.frozen() == false );
+  }
+
+  SECTION("freeze preserves the registered members")
+  {
+    ExampleTranslator translator;
+    translator.add_member("scalar.bool", &ExampleClass::bool_scalar)
+              .add_member("vector.int", &ExampleClass::int_vector)
+              .freeze();
+
+    REQUIRE( translator.members() == 2 );
+    REQUIRE( translator.has_member("scalar.bool") );
+    REQUIRE( translator.has_member("vector.int") );
+  }
+
+  SECTION("Re-adding a member of the same kind replaces it")
+  {
+    ExampleTranslator translator;
+    translator.add_int_member("scalar.int", &ExampleClass::int_scalar)
+              .add_int_member("scalar.int", &ExampleClass::int_scalar);
+
+    REQUIRE( translator.members() == 1 );
+  }
+
+  SECTION("Frozen DataTranslator translates every member")
+  {
+    const ExampleTranslator translator = ExampleTranslator()
+      .add_member("vector.string", &ExampleClass::string_vector)
+      .add_member("scalar.string", &ExampleClass::string_scalar)
+      .add_member("vector.int", &ExampleClass::int_vector)
+      .add_member("scalar.int", &ExampleClass::int_scalar)
+      .freeze();
+
+    ExampleClass example;
+    const auto count = translator.translate(&example, DummyTranslator());
+
+    REQUIRE( count == 4 );
+    REQUIRE( example.int_scalar == DummyTranslator::int_value );
+    REQUIRE( example.string_scalar == DummyTranslator::string_value );
+    REQUIRE( example.int_vector == DummyTranslator::int_vector );
+    REQUIRE( example.string_vector == DummyTranslator::string_vector );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Optional Scheme Functions
+//----------------------------------------------------------------------------
+
+namespace {
+
+  // Dummy translator that provides a fused lookup for integers only
+  class FusedDummyTranslator : public DummyTranslator
+  {
+  public:
+    bool has(const std::string& x) const{ ++has_calls; return DummyTranslator::has(x); }
+
+    bool try_as_int(const std::string&, int& out) const
+    {
+      ++try_calls;
+      out = int_value;
+      return true;
+    }
+
+    bool try_as_float_span(const std::string&, const float*& data, std::size_t& size) const
+    {
+      ++span_calls;
+      data = float_vector.data();
+      size = float_vector.size();
+      return true;
+    }
+
+    mutable int has_calls  = 0;
+    mutable int try_calls  = 0;
+    mutable int span_calls = 0;
+  };
+
+} // anonymous namespace
+
+TEST_CASE("try_as") {
+
+  const ExampleTranslator translator = ExampleTranslator()
+    .add_member("scalar.bool", &ExampleClass::bool_scalar)
+    .add_member("scalar.int", &ExampleClass::int_scalar)
+    .add_member("vector.float", &ExampleClass::float_vector);
+
+  ExampleClass example;
+  FusedDummyTranslator data;
+
+  const auto count = translator.translate(&example, data);
+
+  SECTION("translate uses the fused lookup when available") {
+    REQUIRE( count == 3 );
+    REQUIRE( data.try_calls == 1 );
+    REQUIRE( example.int_scalar == DummyTranslator::int_value );
+  }
+
+  SECTION("translate copies spans in bulk when available") {
+    REQUIRE( data.span_calls == 1 );
+    REQUIRE( example.float_vector.size() == DummyTranslator::float_vector.size() );
+    REQUIRE( std::equal(example.float_vector.begin(), example.float_vector.end(), DummyTranslator::float_vector.begin()) );
+  }
+
+  SECTION("translate falls back to has() for other types") {
+    REQUIRE( data.has_calls == 1 );
+    REQUIRE( example.bool_scalar == DummyTranslator::bool_value );
+  }
+}
+
+TEST_CASE("translate_mode") {
+
+  const ExampleTranslator translator = ExampleTranslator()
+    .add_member("vector.int", &ExampleClass::int_vector)
+    .add_member("vector.string", &ExampleClass::string_vector);
+
+  ExampleClass example;
+  translator.translate(&example, DummyTranslator());
+
+  SECTION("append mode appends to existing vector members") {
+    translator.translate(&example, DummyTranslator(), serial::translate_mode::append);
+
+    REQUIRE( example.int_vector.size() == 2 * DummyTranslator::int_vector.size() );
+    REQUIRE( example.string_vector.size() == 2 * DummyTranslator::string_vector.size() );
+  }
+
+  SECTION("replace mode overwrites existing vector members") {
+    translator.translate(&example, DummyTranslator(), serial::translate_mode::replace);
+
+    REQUIRE( example.int_vector == DummyTranslator::int_vector );
+    REQUIRE( example.string_vector == DummyTranslator::string_vector );
+  }
+
+  SECTION("replace mode keeps the capacity of vector members") {
+    example.int_vector.reserve(64);
+    const int* const data = example.int_vector.data();
+
+    translator.translate(&example, DummyTranslator(), serial::translate_mode::replace);
+
+    REQUIRE( example.int_vector.capacity() == 64 );
+    REQUIRE( example.int_vector.data() == data );
+  }
+
+  SECTION("replace mode removes surplus elements") {
+    example.int_vector.push_back(-1);
+    translator.translate(&example, DummyTranslator(), serial::translate_mode::replace);
+
+    REQUIRE( example.int_vector == DummyTranslator::int_vector );
+  }
+}
+
+TEST_CASE("translate_uniform") {
+
+  SECTION("translate_uniform copies objects that own resources") {
+    const ExampleTranslator translator = ExampleTranslator()
+      .add_member("scalar.string", &ExampleClass::string_scalar)
+      .add_member("vector.string", &ExampleClass::string_vector);
+
+    std::vector<ExampleClass> examples(16);
+    const auto count = translator.translate_uniform(examples.data(), examples.size(), DummyTranslator());
+
+    REQUIRE( count == 2 );
+    for( auto const& example : examples ) {
+      REQUIRE( example.string_scalar == DummyTranslator::string_value );
+      REQUIRE( example.string_vector == DummyTranslator::string_vector );
+    }
+  }
+
+  SECTION("translate_uniform copies large arrays of trivially copyable objects") {
+    struct TrivialClass
+    {
+      int   int_scalar;
+      float float_scalar;
+    };
+    typedef serial::DataTranslator<TrivialClass> TrivialTranslator;
+
+    const TrivialTranslator translator = TrivialTranslator()
+      .add_member("scalar.int", &TrivialClass::int_scalar)
+      .add_member("scalar.float", &TrivialClass::float_scalar);
+
+    std::vector<TrivialClass> examples(100003);
+    translator.translate_uniform(examples.data(), examples.size(), DummyTranslator());
+
+    bool result = true;
+    for( auto const& example : examples ) {
+      result &= (example.int_scalar == DummyTranslator::int_value);
+    }
+    REQUIRE( result );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Parallel Translation
+//----------------------------------------------------------------------------
+
+namespace {
+
+  // Dummy random access sequence of identical entries
+  class DummyRandomAccessTranslator
+  {
+  public:
+    explicit DummyRandomAccessTranslator(std::size_t count) : m_count(count){}
+
+    std::size_t count() const{ return m_count; }
+
+    DummyTranslator at(std::size_t) const{ return DummyTranslator(); }
+
+  private:
+    std::size_t m_count;
+  };
+
+} // anonymous namespace
+
+namespace {
+
+  // Dummy sequence of 3 identical entries
+  class DummySequenceTranslator : public DummyTranslator
+  {
+  public:
+    bool next(){ return ++m_index < 3; }
+  private:
+    int m_index = 0;
+  };
+
+} // anonymous namespace
+
+TEST_CASE("reset") {
+
+  const ExampleTranslator translator = ExampleTranslator()
+    .add_member("scalar.int", &ExampleClass::int_scalar)
+    .add_member("scalar.string", &ExampleClass::string_scalar)
+    .add_member("vector.int", &ExampleClass::int_vector);
+
+  ExampleClass example;
+  example.int_scalar    = 7;
+  example.float_scalar  = 1.5f;
+  example.string_scalar = "a string too long for the small string buffer";
+  example.int_vector.assign(64, 1);
+
+  const auto string_capacity = example.string_scalar.capacity();
+  translator.reset(&example);
+
+  REQUIRE( example.int_scalar == 0 );
+  REQUIRE( example.string_scalar.empty() );
+  REQUIRE( example.string_scalar.capacity() == string_capacity );
+  REQUIRE( example.int_vector.empty() );
+  REQUIRE( example.int_vector.capacity() >= 64 );
+
+  // Members that are not translated are untouched
+  REQUIRE( example.float_scalar == Approx(1.5f) );
+}
+
+TEST_CASE("translate_sequence_into") {
+
+  const ExampleTranslator translator = ExampleTranslator()
+    .add_member("scalar.int", &ExampleClass::int_scalar)
+    .add_member("vector.int", &ExampleClass::int_vector)
+    .add_member("vector.string", &ExampleClass::string_vector)
+    .freeze();
+
+  std::vector<ExampleClass> examples;
+
+  SECTION("Entries are constructed in the container") {
+    DummySequenceTranslator data;
+    const auto count = translator.translate_sequence_into(examples, data);
+
+    REQUIRE( count == 9 );
+    REQUIRE( examples.size() == 3 );
+    for( const auto& example : examples ) {
+      REQUIRE( example.int_vector == DummyTranslator::int_vector );
+      REQUIRE( example.string_vector == DummyTranslator::string_vector );
+    }
+  }
+
+  SECTION("Existing objects are reused and keep their capacity") {
+    examples.resize(5);
+    examples[0].int_vector.assign(64, -1);
+    const int* const data_pointer = examples[0].int_vector.data();
+
+    DummySequenceTranslator data;
+    translator.translate_sequence_into(examples, data);
+
+    REQUIRE( examples.size() == 3 );
+    REQUIRE( examples[0].int_vector.data() == data_pointer );
+    REQUIRE( examples[0].int_vector == DummyTranslator::int_vector );
+    REQUIRE( examples[2].int_scalar == DummyTranslator::int_value );
+  }
+}
+
+TEST_CASE("shared plans") {
+
+  ExampleTranslator translator = ExampleTranslator()
+    .add_member("scalar.int", &ExampleClass::int_scalar)
+    .add_member("vector.string", &ExampleClass::string_vector);
+
+  SECTION("Copies are independent once modified") {
+    ExampleTranslator copy = translator;
+    copy.add_member("scalar.float", &ExampleClass::float_scalar).freeze();
+
+    REQUIRE( copy.members() == 3 );
+    REQUIRE( copy.frozen() );
+    REQUIRE( translator.members() == 2 );
+    REQUIRE( !translator.frozen() );
+    REQUIRE( !translator.has_member("scalar.float") );
+  }
+
+  SECTION("Moved-from translators remain usable") {
+    ExampleTranslator moved = std::move(translator);
+
+    REQUIRE( moved.members() == 2 );
+    REQUIRE( translator.members() == 2 );
+  }
+
+  SECTION("Frozen plans are translated concurrently") {
+    translator.freeze();
+
+    const std::size_t threads    = 8;
+    const std::size_t iterations = 2000;
+
+    std::atomic<std::size_t> failures(0);
+    std::vector<std::thread> workers;
+
+    for( std::size_t t = 0; t < threads; ++t ) {
+      workers.emplace_back([&translator,&failures,t,iterations]()
+      {
+        // Half of the threads share the translator, and half use copies
+        const ExampleTranslator copy = translator;
+        const ExampleTranslator& local = (t % 2) ? copy : translator;
+
+        for( std::size_t i = 0; i < iterations; ++i ) {
+          ExampleClass example;
+          const auto count = local.translate(&example, DummyTranslator());
+
+          if( count != 2 ||
+              example.int_scalar != DummyTranslator::int_value ||
+              example.string_vector != DummyTranslator::string_vector ) {
+            ++failures;
+          }
+        }
+      });
+    }
+    for( auto& worker : workers ) worker.join();
+
+    REQUIRE( failures == 0 );
+  }
+}
+
+TEST_CASE("translate_sequence_parallel") {
+
+  const ExampleTranslator translator = ExampleTranslator()
+    .add_member("scalar.int", &ExampleClass::int_scalar)
+    .add_member("scalar.string", &ExampleClass::string_scalar)
+    .add_member("vector.float", &ExampleClass::float_vector)
+    .freeze();
+
+  SECTION("translate_sequence_parallel translates every entry") {
+    std::vector<ExampleClass> examples(1000);
+    const auto count = translator.translate_sequence_parallel(examples.begin(), DummyRandomAccessTranslator(examples.size()), 4);
+
+    REQUIRE( count == 3000 );
+
+    bool result = true;
+    for( auto const& example : examples ) {
+      result &= (example.int_scalar == DummyTranslator::int_value);
+      result &= (example.string_scalar == DummyTranslator::string_value);
+      result &= (example.float_vector.size() == DummyTranslator::float_vector.size());
+    }
+    REQUIRE( result );
+  }
+
+  SECTION("translate_sequence_parallel translates on a single thread") {
+    std::vector<ExampleClass> examples(10);
+    const auto count = translator.translate_sequence_parallel(examples.begin(), DummyRandomAccessTranslator(examples.size()), 1);
+
+    REQUIRE( count == 30 );
+  }
+
+  SECTION("translate_sequence_parallel handles empty sequences") {
+    std::vector<ExampleClass> examples;
+    const auto count = translator.translate_sequence_parallel(examples.begin(), DummyRandomAccessTranslator(0));
+
+    REQUIRE( count == 0 );
+  }
+}
+
+TEST_CASE("translate_batch") {
+
+  const ExampleTranslator translator = ExampleTranslator()
+    .add_member("scalar.int", &ExampleClass::int_scalar)
+    .add_member("scalar.string", &ExampleClass::string_scalar)
+    .add_member("vector.int", &ExampleClass::int_vector)
+    .freeze();
+
+  std::vector<ExampleClass>    examples(20);
+  std::vector<DummyTranslator> schemes(examples.size());
+
+  const auto count = translator.translate_batch(examples.data(), schemes.data(), examples.size());
+
+  SECTION("translate_batch translates every member of every object") {
+    REQUIRE( count == 60 );
+  }
+
+  SECTION("translate_batch translates entries correctly") {
+    bool result = true;
+    for( auto const& example : examples ) {
+      result &= (example.int_scalar == DummyTranslator::int_value);
+      result &= (example.string_scalar == DummyTranslator::string_value);
+      result &= (example.int_vector == DummyTranslator::int_vector);
+    }
+    REQUIRE( result );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Pull Translation
+//----------------------------------------------------------------------------
+
+namespace {
+
+  // Dummy translator that only contains the keys it is constructed with
+  class DummyPullTranslator : public DummyTranslator
+  {
+  public:
+    explicit DummyPullTranslator(std::vector<std::string> keys) : m_keys(std::move(keys)){}
+
+    bool has(const std::string& x) const
+    {
+      return std::find(m_keys.begin(), m_keys.end(), x) != m_keys.end();
+    }
+
+    template<typename Func>
+    void for_each_key(Func func) const
+    {
+      for(const auto& key : m_keys) {
+        func(key);
+      }
+    }
+
+  private:
+    std::vector<std::string> m_keys;
+  };
+
+} // anonymous namespace
+
+TEST_CASE("translate_pull") {
+
+  ExampleTranslator translator = ExampleTranslator()
+    .add_member("scalar.bool", &ExampleClass::bool_scalar)
+    .add_member("scalar.int", &ExampleClass::int_scalar)
+    .add_member("scalar.float", &ExampleClass::float_scalar)
+    .add_member("scalar.string", &ExampleClass::string_scalar)
+    .add_member("vector.int", &ExampleClass::int_vector);
+
+  const DummyPullTranslator data({"scalar.int", "vector.int", "unregistered"});
+
+  ExampleClass example;
+  example.bool_scalar = false;
+
+  SECTION("translate_pull translates only the present keys") {
+    translator.freeze();
+    const auto count = translator.translate_pull(&example, data);
+
+    REQUIRE( count == 2 );
+    REQUIRE( example.bool_scalar == false );
+    REQUIRE( example.int_scalar == DummyTranslator::int_value );
+    REQUIRE( example.int_vector == DummyTranslator::int_vector );
+  }
+
+  SECTION("translate_pull translates without freezing") {
+    const auto count = translator.translate_pull(&example, data);
+
+    REQUIRE( count == 2 );
+    REQUIRE( example.int_scalar == DummyTranslator::int_value );
+  }
+}
+
+TEST_CASE("frozen key lookup") {
+
+  ExampleTranslator translator;
+  for( int i = 0; i < 2000; ++i ) {
+    translator.add_int_member("scalar.int." + std::to_string(i), &ExampleClass::int_scalar);
+  }
+  translator.add_float_member("scalar.int.0", &ExampleClass::float_scalar);
+  translator.freeze();
+
+  SECTION("has_member finds every registered key") {
+    bool result = true;
+    for( int i = 0; i < 2000; ++i ) {
+      result &= translator.has_member("scalar.int." + std::to_string(i));
+    }
+    REQUIRE( result );
+  }
+
+  SECTION("has_member rejects unregistered keys") {
+    bool result = false;
+    for( int i = 2000; i < 4000; ++i ) {
+      result |= translator.has_member("scalar.int." + std::to_string(i));
+    }
+    REQUIRE( result == false );
+    REQUIRE( translator.has_member("") == false );
+  }
+
+  SECTION("translate_pull dispatches a key to all of its members") {
+    ExampleClass example;
+    const auto count = translator.translate_pull(&example, DummyPullTranslator({"scalar.int.0"}));
+
+    REQUIRE( count == 2 );
+    REQUIRE( example.int_scalar == DummyTranslator::int_value );
+    REQUIRE( example.float_scalar == DummyTranslator::float_value );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Prepared Keys
+//----------------------------------------------------------------------------
+
+TEST_CASE("prepare") {
+
+  PreparingDummyTranslator::prepare_calls = 0;
+  PreparingDummyTranslator::handle_calls  = 0;
+
+  const ExampleTranslator translator = ExampleTranslator()
+    .add_member("scalar.int", &ExampleClass::int_scalar)
+    .add_member("vector.int", &ExampleClass::int_vector)
+    .freeze()
+    .prepare(PreparingDummyTranslator());
+
+  SECTION("prepare prepares each member once") {
+    REQUIRE( PreparingDummyTranslator::prepare_calls == 2 );
+  }
+
+  SECTION("translate passes prepared keys to the scheme") {
+    ExampleClass example;
+    translator.translate(&example, PreparingDummyTranslator());
+    translator.translate(&example, PreparingDummyTranslator(), serial::translate_mode::replace);
+
+    REQUIRE( PreparingDummyTranslator::prepare_calls == 2 );
+    REQUIRE( PreparingDummyTranslator::handle_calls == 4 );
+    REQUIRE( example.int_scalar == DummyTranslator::int_value );
+    REQUIRE( example.int_vector == DummyTranslator::int_vector );
+  }
+
+  SECTION("translate_batch passes prepared keys to the scheme") {
+    std::vector<ExampleClass>             examples(3);
+    std::vector<PreparingDummyTranslator> schemes(examples.size());
+    translator.translate_batch(examples.data(), schemes.data(), examples.size());
+
+    REQUIRE( PreparingDummyTranslator::handle_calls == 6 );
+  }
+
+  SECTION("Adding members discards prepared keys") {
+    ExampleTranslator copy = translator;
+    copy.add_member("scalar.float", &ExampleClass::float_scalar);
+
+    ExampleClass example;
+    copy.translate(&example, PreparingDummyTranslator());
+
+    REQUIRE( PreparingDummyTranslator::handle_calls == 0 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Key Paths
+//----------------------------------------------------------------------------
+
+namespace {
+
+  // Dummy translator that records the child nodes and keys it resolves
+  class DummyPathTranslator : public DummyTranslator
+  {
+  public:
+    DummyPathTranslator(std::vector<std::string>* children,
+                        std::vector<std::string>* keys,
+                        std::string path = std::string())
+      : m_children(children), m_keys(keys), m_path(std::move(path)){}
+
+    DummyPathTranslator child(const std::string& x) const
+    {
+      m_children->push_back(m_path + x);
+      return DummyPathTranslator(m_children, m_keys, m_path + x + ".");
+    }
+
+    bool has(const std::string& x) const
+    {
+      m_keys->push_back(m_path + x);
+      return true;
+    }
+
+  private:
+    std::vector<std::string>* m_children;
+    std::vector<std::string>* m_keys;
+    std::string               m_path;
+  };
+
+} // anonymous namespace
+
+TEST_CASE("key paths") {
+
+  ExampleTranslator translator = ExampleTranslator()
+    .add_member("my.scalar.int", &ExampleClass::int_scalar)
+    .add_member("my.scalar.float", &ExampleClass::float_scalar)
+    .add_member("my.vector.int", &ExampleClass::int_vector)
+    .add_member("my.bool", &ExampleClass::bool_scalar)
+    .add_member("string", &ExampleClass::string_scalar);
+
+  std::vector<std::string> children;
+  std::vector<std::string> keys;
+  const DummyPathTranslator data(&children, &keys);
+
+  ExampleClass example;
+
+  SECTION("Frozen translators resolve each key prefix once") {
+    translator.freeze();
+    const auto count = translator.translate(&example, data);
+
+    std::sort(children.begin(), children.end());
+    std::sort(keys.begin(), keys.end());
+
+    REQUIRE( count == 5 );
+    REQUIRE( children == std::vector<std::string>({"my", "my.scalar", "my.vector"}) );
+    REQUIRE( keys == std::vector<std::string>({"my.bool", "my.scalar.float", "my.scalar.int", "my.vector.int", "string"}) );
+    REQUIRE( example.int_scalar == DummyTranslator::int_value );
+    REQUIRE( example.float_scalar == DummyTranslator::float_value );
+    REQUIRE( example.int_vector == DummyTranslator::int_vector );
+  }
+
+  SECTION("Unfrozen translators request the full keys") {
+    const auto count = translator.translate(&example, data);
+
+    REQUIRE( count == 5 );
+    REQUIRE( children.empty() );
+    REQUIRE( keys.size() == 5 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Nested Structures
+//----------------------------------------------------------------------------
+
+namespace {
+
+  struct DeepClass
+  {
+    std::vector<int> int_vector;
+  };
+
+  struct InnerClass
+  {
+    bool        bool_scalar;
+    std::string string_scalar;
+    DeepClass   deep;
+  };
+
+  struct OuterClass
+  {
+    int        int_scalar;
+    InnerClass first;
+    InnerClass second;
+  };
+
+} // anonymous namespace
+
+TEST_CASE("nested structures") {
+
+  typedef serial::DataTranslator<DeepClass>  DeepTranslator;
+  typedef serial::DataTranslator<InnerClass> InnerTranslator;
+  typedef serial::DataTranslator<OuterClass> OuterTranslator;
+
+  const DeepTranslator deep = DeepTranslator()
+    .add_member("ints", &DeepClass::int_vector);
+
+  const InnerTranslator inner = InnerTranslator()
+    .add_member("bool", &InnerClass::bool_scalar)
+    .add_member("string", &InnerClass::string_scalar)
+    .add_member("deep", &InnerClass::deep, deep);
+
+  OuterTranslator translator = OuterTranslator()
+    .add_member("int", &OuterClass::int_scalar)
+    .add_member("first", &OuterClass::first, inner)
+    .add_member("second", &OuterClass::second, inner);
+
+  std::vector<std::string> children;
+  std::vector<std::string> keys;
+  const DummyPathTranslator data(&children, &keys);
+
+  OuterClass example;
+
+  SECTION("Nested members are flattened into the plan") {
+    REQUIRE( translator.members() == 7 );
+    REQUIRE( translator.has_member("first.deep.ints") );
+    REQUIRE( translator.has_member("second.string") );
+    REQUIRE( !translator.has_member("first") );
+  }
+
+  SECTION("Nested members are translated at their composed offsets") {
+    translator.freeze();
+    const auto count = translator.translate(&example, data);
+
+    std::sort(children.begin(), children.end());
+
+    REQUIRE( count == 7 );
+    REQUIRE( children == std::vector<std::string>({"first", "first.deep", "second", "second.deep"}) );
+    REQUIRE( example.int_scalar == DummyTranslator::int_value );
+    REQUIRE( example.first.bool_scalar == DummyTranslator::bool_value );
+    REQUIRE( example.second.string_scalar == DummyTranslator::string_value );
+    REQUIRE( example.first.deep.int_vector == DummyTranslator::int_vector );
+    REQUIRE( example.second.deep.int_vector == DummyTranslator::int_vector );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Structure Vectors
+//----------------------------------------------------------------------------
+
+namespace {
+
+  struct ListClass
+  {
+    int                     int_scalar;
+    std::vector<InnerClass> items;
+  };
+
+  // Dummy translator whose sequences of structures hold 3 identical entries
+  class DummyElementTranslator : public DummyTranslator
+  {
+  public:
+    DummyRandomAccessTranslator as_sequence(const std::string&) const{ return DummyRandomAccessTranslator(3); }
+  };
+
+} // anonymous namespace
+
+TEST_CASE("structure vectors") {
+
+  typedef serial::DataTranslator<DeepClass>  DeepTranslator;
+  typedef serial::DataTranslator<InnerClass> InnerTranslator;
+  typedef serial::DataTranslator<ListClass>  ListTranslator;
+
+  const DeepTranslator deep = DeepTranslator()
+    .add_member("ints", &DeepClass::int_vector);
+
+  const InnerTranslator inner = InnerTranslator()
+    .add_member("bool", &InnerClass::bool_scalar)
+    .add_member("string", &InnerClass::string_scalar)
+    .add_member("deep", &InnerClass::deep, deep);
+
+  const ListTranslator translator = ListTranslator()
+    .add_member("int", &ListClass::int_scalar)
+    .add_member("items", &ListClass::items, inner)
+    .freeze();
+
+  const DummyElementTranslator data;
+
+  ListClass example;
+
+  SECTION("Each element is translated with the element members") {
+    const auto count = translator.translate(&example, data);
+
+    REQUIRE( count == 2 );
+    REQUIRE( translator.members() == 2 );
+    REQUIRE( example.items.size() == 3 );
+    for( const auto& item : example.items ) {
+      REQUIRE( item.bool_scalar == DummyTranslator::bool_value );
+      REQUIRE( item.string_scalar == DummyTranslator::string_value );
+      REQUIRE( item.deep.int_vector == DummyTranslator::int_vector );
+    }
+  }
+
+  SECTION("replace mode reuses the existing elements") {
+    example.items.resize(5);
+    example.items[0].deep.int_vector.assign(64, -1);
+    const int* const pointer = example.items[0].deep.int_vector.data();
+
+    translator.translate(&example, data, serial::translate_mode::replace);
+
+    REQUIRE( example.items.size() == 3 );
+    REQUIRE( example.items[0].deep.int_vector.data() == pointer );
+    REQUIRE( example.items[0].deep.int_vector == DummyTranslator::int_vector );
+  }
+
+  SECTION("append mode appends new elements") {
+    example.items.resize(2);
+    translator.translate(&example, data, serial::translate_mode::append);
+
+    REQUIRE( example.items.size() == 5 );
+    REQUIRE( example.items[0].string_scalar.empty() );
+    REQUIRE( example.items[4].string_scalar == DummyTranslator::string_value );
+  }
+
+  SECTION("Schemes without as_sequence leave the member untouched") {
+    example.items.resize(2);
+    const auto count = translator.translate(&example, DummyTranslator());
+
+    REQUIRE( count == 1 );
+    REQUIRE( example.items.size() == 2 );
+  }
+
+  SECTION("reset clears the elements") {
+    translator.translate(&example, data);
+    translator.reset(&example);
+
+    REQUIRE( example.items.empty() );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Key Strings
+//----------------------------------------------------------------------------
+
+namespace {
+
+  // Dummy translator that is keyed on wide strings
+  class WideDummyTranslator
+  {
+  public:
+    std::size_t size(const std::wstring& x) const{ return m_data.size(narrow(x)); }
+    bool        has(const std::wstring& x) const{ return x != L"absent"; }
+
+    bool        as_bool(const std::wstring& x) const{ return m_data.as_bool(narrow(x)); }
+    int         as_int(const std::wstring& x) const{ return m_data.as_int(narrow(x)); }
+    float       as_float(const std::wstring& x) const{ return m_data.as_float(narrow(x)); }
+    std::string as_string(const std::wstring& x) const{ return m_data.as_string(narrow(x)); }
+
+    template<typename Func>
+    void as_bool_sequence(const std::wstring& x, Func func) const{ m_data.as_bool_sequence(narrow(x), func); }
+
+    template<typename Func>
+    void as_int_sequence(const std::wstring& x, Func func) const{ m_data.as_int_sequence(narrow(x), func); }
+
+    template<typename Func>
+    void as_float_sequence(const std::wstring& x, Func func) const{ m_data.as_float_sequence(narrow(x), func); }
+
+    template<typename Func>
+    void as_string_sequence(const std::wstring& x, Func func) const{ m_data.as_string_sequence(narrow(x), func); }
+
+  private:
+    static std::string narrow(const std::wstring& x){ return std::string(x.begin(), x.end()); }
+
+    DummyTranslator m_data;
+  };
+
+} // anonymous namespace
+
+TEST_CASE("wide keys") {
+
+  typedef serial::DataTranslator<ExampleClass,bool,int,float,std::string,std::wstring> WideTranslator;
+
+  WideTranslator translator = WideTranslator()
+    .add_member(L"my.int", &ExampleClass::int_scalar)
+    .add_member(L"my.vector.int", &ExampleClass::int_vector)
+    .add_member(L"absent", &ExampleClass::float_scalar);
+
+  SECTION("Wide keys are looked up by wide strings") {
+    REQUIRE( translator.has_member(L"my.int") == true );
+    REQUIRE( translator.has_member(std::wstring(L"my.vector.int")) == true );
+    REQUIRE( translator.has_member(L"my") == false );
+
+    translator.freeze();
+    REQUIRE( translator.has_member(L"my.int") == true );
+    REQUIRE( translator.has_member(L"my") == false );
+  }
+
+  SECTION("Wide keys are translated") {
+    translator.freeze();
+
+    ExampleClass example;
+    const auto count = translator.translate(&example, WideDummyTranslator());
+
+    REQUIRE( count == 2 );
+    REQUIRE( example.int_scalar == DummyTranslator::int_value );
+    REQUIRE( example.int_vector == DummyTranslator::int_vector );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Hashed Keys
+//----------------------------------------------------------------------------
+
+static_assert(SERIAL_KEY("my.int").size() == 6, "SERIAL_KEY must be usable in constant expressions");
+static_assert(SERIAL_KEY("my.int").hash() == serial::detail::hash_literal("my.int"), "SERIAL_KEY must be hashed at compile time");
+
+TEST_CASE("hashed keys") {
+
+  SECTION("Compile-time hashes match runtime hashes") {
+    REQUIRE( SERIAL_KEY("my.int").hash() == serial::detail::hash_key(std::string("my.int")) );
+    REQUIRE( serial::hashed_key("my.int") == SERIAL_KEY("my.int") );
+    REQUIRE( serial::hashed_key("my.float") != SERIAL_KEY("my.int") );
+  }
+
+  ExampleTranslator translator = ExampleTranslator()
+    .add_member(SERIAL_KEY("scalar.int"), &ExampleClass::int_scalar)
+    .add_member(SERIAL_KEY("vector.float"), &ExampleClass::float_vector)
+    .add_member("scalar.string", &ExampleClass::string_scalar);
+
+  SECTION("Hashed keys name members") {
+    REQUIRE( translator.members() == 3 );
+    REQUIRE( translator.has_member("scalar.int") );
+    REQUIRE( translator.has_member(SERIAL_KEY("scalar.string")) );
+
+    translator.freeze();
+    REQUIRE( translator.has_member(SERIAL_KEY("vector.float")) );
+    REQUIRE( !translator.has_member(SERIAL_KEY("vector.int")) );
+  }
+
+  SECTION("Schemes that accept hashed keys are passed them") {
+    HashingDummyTranslator::hashed_calls      = 0;
+    HashingDummyTranslator::mismatched_hashes = 0;
+
+    ExampleClass example;
+    const auto count = translator.translate(&example, HashingDummyTranslator());
+
+    REQUIRE( count == 3 );
+    REQUIRE( HashingDummyTranslator::hashed_calls == 3 );
+    REQUIRE( HashingDummyTranslator::mismatched_hashes == 0 );
+    REQUIRE( example.int_scalar == DummyTranslator::int_value );
+    REQUIRE( example.float_vector == DummyTranslator::float_vector );
+    REQUIRE( example.string_scalar == DummyTranslator::string_value );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Key Table
+//----------------------------------------------------------------------------
+
+namespace {
+
+  // Dummy translator that records the keys it is passed
+  class KeyRecordingTranslator : public HashingDummyTranslator
+  {
+  public:
+    explicit KeyRecordingTranslator(std::vector<serial::hashed_key>* keys) : m_keys(keys){}
+
+    using HashingDummyTranslator::has;
+
+    bool has(const serial::hashed_key& x) const
+    {
+      m_keys->push_back(x);
+      return HashingDummyTranslator::has(x);
+    }
+
+  private:
+    std::vector<serial::hashed_key>* m_keys;
+  };
+
+} // anonymous namespace
+
+TEST_CASE("key table") {
+
+  ExampleTranslator translator = ExampleTranslator()
+    .add_member("scalar.int", &ExampleClass::int_scalar)
+    .add_member("scalar.float", &ExampleClass::float_scalar)
+    .add_member("a.key.longer.than.a.single.block", &ExampleClass::string_scalar)
+    .freeze();
+
+  std::vector<serial::hashed_key> keys;
+
+  ExampleClass example;
+  translator.translate(&example, KeyRecordingTranslator(&keys));
+
+  REQUIRE( keys.size() == 3 );
+
+  SECTION("Frozen keys are interned into one padded buffer") {
+    std::sort(keys.begin(), keys.end(), [](const serial::hashed_key& lhs, const serial::hashed_key& rhs)
+    {
+      return lhs.data() < rhs.data();
+    });
+
+    for( const auto& key : keys ) {
+      const auto padding = (key.size() / 16 + 1) * 16 - key.size();
+
+      REQUIRE( key.data()[key.size()] == '\0' );
+      REQUIRE( std::count(key.data() + key.size(), key.data() + key.size() + padding, '\0') == padding );
+    }
+    REQUIRE( (keys[1].data() - keys[0].data()) % 16 == 0 );
+    REQUIRE( keys[2].data() - keys[0].data() < 96 );
+  }
+
+  SECTION("Frozen keys are looked up in the key table") {
+    REQUIRE( translator.has_member("a.key.longer.than.a.single.block") );
+    REQUIRE( !translator.has_member("a.key.longer.than.a.single.bloc") );
+    REQUIRE( !translator.has_member("scalar.int.") );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Borrowed Strings
+//----------------------------------------------------------------------------
+
+namespace {
+
+  struct BorrowingClass
+  {
+    std::string                      string_scalar;
+    serial::string_view              string_view_scalar;
+    std::vector<serial::string_view> string_view_vector;
+  };
+
+} // anonymous namespace
+
+TEST_CASE("borrowed strings") {
+
+  typedef serial::DataTranslator<BorrowingClass> BorrowingTranslator;
+
+  BorrowingTranslator translator = BorrowingTranslator()
+    .add_member("scalar.string", &BorrowingClass::string_scalar)
+    .add_member("scalar.view", &BorrowingClass::string_view_scalar)
+    .add_member("vector.view", &BorrowingClass::string_view_vector);
+
+  SECTION("Views point into the document of the scheme") {
+    BorrowingClass example;
+    const auto count = translator.translate(&example, BorrowingDummyTranslator());
+
+    REQUIRE( count == 3 );
+    REQUIRE( example.string_scalar == DummyTranslator::string_value );
+    REQUIRE( example.string_view_scalar.data() == DummyTranslator::string_value.data() );
+    REQUIRE( example.string_view_scalar == DummyTranslator::string_value );
+    REQUIRE( example.string_view_vector.size() == DummyTranslator::string_vector.size() );
+
+    for( std::size_t i = 0; i < example.string_view_vector.size(); ++i ) {
+      REQUIRE( example.string_view_vector[i].data() == DummyTranslator::string_vector[i].data() );
+    }
+  }
+
+  SECTION("Views are converted to owning strings explicitly") {
+    BorrowingClass example;
+    translator.freeze().translate(&example, BorrowingDummyTranslator());
+
+    const std::string copy( example.string_view_scalar );
+    REQUIRE( copy == DummyTranslator::string_value );
+    REQUIRE( copy.data() != DummyTranslator::string_value.data() );
+  }
+
+  SECTION("Schemes that cannot lend strings leave views untranslated") {
+    BorrowingClass example;
+    const auto count = translator.translate(&example, DummyTranslator());
+
+    REQUIRE( count == 1 );
+    REQUIRE( example.string_view_scalar.empty() );
+    REQUIRE( example.string_view_vector.empty() );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Converted Members
+//----------------------------------------------------------------------------
+
+namespace {
+
+  struct Millis
+  {
+    long long count;
+  };
+
+  struct ConvertedClass
+  {
+    Millis              timeout;
+    std::size_t         name_length;
+    std::vector<Millis> intervals;
+    std::vector<char>   initials;
+  };
+
+  std::size_t length_of(const std::string& s){ return s.size(); }
+
+} // anonymous namespace
+
+TEST_CASE("converted members") {
+
+  typedef serial::DataTranslator<ConvertedClass> ConvertedTranslator;
+
+  const auto to_millis = [](int ms){ return Millis{ 10 * ms }; };
+
+  ConvertedTranslator translator = ConvertedTranslator()
+    .add_member("timeout", &ConvertedClass::timeout, to_millis)
+    .add_member("name", &ConvertedClass::name_length, &length_of)
+    .add_member("intervals", &ConvertedClass::intervals, to_millis)
+    .add_member("initials", &ConvertedClass::initials, [](const serial::string_view& s){ return s[0]; });
+
+  ConvertedClass example;
+
+  SECTION("Values are converted into the members") {
+    const auto count = translator.freeze().translate(&example, BorrowingDummyTranslator());
+
+    REQUIRE( count == 4 );
+    REQUIRE( example.timeout.count == 10 * DummyTranslator::int_value );
+    REQUIRE( example.name_length == DummyTranslator::string_value.size() );
+    REQUIRE( example.intervals.size() == DummyTranslator::int_vector.size() );
+    REQUIRE( example.intervals.back().count == 10 * DummyTranslator::int_vector.back() );
+    REQUIRE( example.initials.size() == DummyTranslator::string_vector.size() );
+    REQUIRE( example.initials.front() == DummyTranslator::string_vector.front()[0] );
+  }
+
+  SECTION("Converted vectors honour the translate mode") {
+    example.intervals.assign(64, Millis{ -1 });
+    const Millis* const data = example.intervals.data();
+
+    translator.translate(&example, DummyTranslator(), serial::translate_mode::replace);
+
+    REQUIRE( example.intervals.size() == DummyTranslator::int_vector.size() );
+    REQUIRE( example.intervals.data() == data );
+
+    translator.translate(&example, DummyTranslator(), serial::translate_mode::append);
+
+    REQUIRE( example.intervals.size() == 2 * DummyTranslator::int_vector.size() );
+  }
+
+  SECTION("Schemes that cannot lend strings leave view converters untranslated") {
+    const auto count = translator.translate(&example, DummyTranslator());
+
+    REQUIRE( count == 3 );
+    REQUIRE( example.initials.empty() );
+  }
+
+  SECTION("reset resets converted members") {
+    translator.translate(&example, BorrowingDummyTranslator());
+    translator.reset(&example);
+
+    REQUIRE( example.timeout.count == 0 );
+    REQUIRE( example.intervals.empty() );
+    REQUIRE( example.initials.empty() );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Enum Members
+//----------------------------------------------------------------------------
+
+namespace {
+
+  enum class Color : unsigned char { red = 1, green = 2, blue = 3 };
+
+  struct EnumClass
+  {
+    Color color;
+    int   int_scalar;
+  };
+
+  // Dummy translator whose strings are all the given text
+  class TextDummyTranslator : public DummyTranslator
+  {
+  public:
+    explicit TextDummyTranslator(std::string text) : m_text(std::move(text)){}
+
+    std::string as_string(const std::string&) const{ return m_text; }
+  private:
+    std::string m_text;
+  };
+
+} // anonymous namespace
+
+TEST_CASE("enum members") {
+
+  typedef serial::DataTranslator<EnumClass> EnumTranslator;
+
+  const EnumTranslator translator = EnumTranslator()
+    .add_enum_member("color", &EnumClass::color, {{"red", Color::red}, {"green", Color::green}, {"blue", Color::blue}})
+    .add_member("int", &EnumClass::int_scalar)
+    .freeze();
+
+  EnumClass example;
+  example.color = Color::red;
+
+  SECTION("Names are translated into their values") {
+    const auto count = translator.translate(&example, TextDummyTranslator("blue"));
+
+    REQUIRE( count == 2 );
+    REQUIRE( example.color == Color::blue );
+  }
+
+  SECTION("Integer-coded values are accepted") {
+    const auto count = translator.translate(&example, TextDummyTranslator("2"));
+
+    REQUIRE( count == 2 );
+    REQUIRE( example.color == Color::green );
+  }
+
+  SECTION("Unknown names and codes leave the member untouched") {
+    REQUIRE( translator.translate(&example, TextDummyTranslator("purple")) == 1 );
+    REQUIRE( translator.translate(&example, TextDummyTranslator("7")) == 1 );
+    REQUIRE( translator.translate(&example, TextDummyTranslator("")) == 1 );
+    REQUIRE( example.color == Color::red );
+  }
+
+  SECTION("Names are borrowed from schemes that lend strings") {
+    const EnumTranslator borrowing = EnumTranslator()
+      .add_enum_member("color", &EnumClass::color, {{"red", Color::red}, {"hello world", Color::blue}});
+
+    const auto count = borrowing.translate(&example, BorrowingDummyTranslator());
+
+    REQUIRE( count == 1 );
+    REQUIRE( example.color == Color::blue );
+  }
+
+  SECTION("reset resets enum members") {
+    translator.reset(&example);
+
+    REQUIRE( static_cast<int>(example.color) == 0 );
+  }
+}
@@ -20,5 +20,8 @@ const std::vector<int>         DummyTranslator::int_vector  = {1, 2, 3, 5, 8};
 const std::vector<float>       DummyTranslator::float_vector = {0.5, 1.5, 3.5, 7.0, 11.1};
 const std::vector<std::string> DummyTranslator::string_vector = {"h","e","l","l","o"};
 
+int PreparingDummyTranslator::prepare_calls = 0;
+int PreparingDummyTranslator::handle_calls  = 0;
 
-
+int HashingDummyTranslator::hashed_calls      = 0;
+int HashingDummyTranslator::mismatched_hashes = 0;
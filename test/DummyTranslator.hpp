@@ -10,6 +10,9 @@
 #ifndef TEST_DUMMYTRANSLATOR_HPP_
 #define TEST_DUMMYTRANSLATOR_HPP_
 
+#include <HashedKey.hpp>
+#include <StringView.hpp>
+
 #include <string>
 #include <vector>
 
@@ -37,7 +40,7 @@ public:
   std::string as_string(const std::string&) const{ return string_value; }
 
   template<typename Func>
-  void as_bool_sequence(std::string, Func func) const
+  void as_bool_sequence(const std::string&, Func func) const
   {
     for(bool b : bool_vector) {
       func(b);
@@ -45,7 +48,7 @@ public:
   }
 
   template<typename Func>
-  void as_int_sequence(std::string, Func func) const
+  void as_int_sequence(const std::string&, Func func) const
   {
     for(int i : int_vector) {
       func(i);
@@ -53,7 +56,7 @@ public:
   }
 
   template<typename Func>
-  void as_float_sequence(std::string, Func func) const
+  void as_float_sequence(const std::string&, Func func) const
   {
     for(float f : float_vector) {
       func(f);
@@ -61,7 +64,7 @@ public:
   }
 
   template<typename Func>
-  void as_string_sequence(std::string, Func func) const
+  void as_string_sequence(const std::string&, Func func) const
   {
     for(const auto& s : string_vector) {
       func(s);
@@ -70,4 +73,118 @@ public:
 
 };
 
+/// Key handle returned by PreparingDummyTranslator::prepare
+struct PreparedKey
+{
+  std::string key;
+};
+
+class PreparingDummyTranslator : public DummyTranslator
+{
+public:
+
+  static int prepare_calls;
+  static int handle_calls;
+
+  using DummyTranslator::size;
+  using DummyTranslator::has;
+  using DummyTranslator::as_bool;
+  using DummyTranslator::as_int;
+  using DummyTranslator::as_float;
+  using DummyTranslator::as_string;
+  using DummyTranslator::as_bool_sequence;
+  using DummyTranslator::as_int_sequence;
+  using DummyTranslator::as_float_sequence;
+  using DummyTranslator::as_string_sequence;
+
+  PreparedKey prepare(const std::string& key) const{ ++prepare_calls; return PreparedKey{key}; }
+
+  std::size_t size(const PreparedKey& x) const{ return size(x.key); }
+
+  bool has(const PreparedKey& x) const{ ++handle_calls; return has(x.key); }
+
+  bool        as_bool(const PreparedKey& x) const{ return as_bool(x.key); }
+  int         as_int(const PreparedKey& x) const{ return as_int(x.key); }
+  float       as_float(const PreparedKey& x) const{ return as_float(x.key); }
+  std::string as_string(const PreparedKey& x) const{ return as_string(x.key); }
+
+  template<typename Func>
+  void as_bool_sequence(const PreparedKey& x, Func func) const{ as_bool_sequence(x.key, func); }
+
+  template<typename Func>
+  void as_int_sequence(const PreparedKey& x, Func func) const{ as_int_sequence(x.key, func); }
+
+  template<typename Func>
+  void as_float_sequence(const PreparedKey& x, Func func) const{ as_float_sequence(x.key, func); }
+
+  template<typename Func>
+  void as_string_sequence(const PreparedKey& x, Func func) const{ as_string_sequence(x.key, func); }
+
+};
+
+class HashingDummyTranslator : public DummyTranslator
+{
+public:
+
+  static int hashed_calls;
+  static int mismatched_hashes;
+
+  using DummyTranslator::size;
+  using DummyTranslator::has;
+  using DummyTranslator::as_bool;
+  using DummyTranslator::as_int;
+  using DummyTranslator::as_float;
+  using DummyTranslator::as_string;
+  using DummyTranslator::as_bool_sequence;
+  using DummyTranslator::as_int_sequence;
+  using DummyTranslator::as_float_sequence;
+  using DummyTranslator::as_string_sequence;
+
+  std::size_t size(const serial::hashed_key& x) const{ return size(key(x)); }
+
+  bool has(const serial::hashed_key& x) const
+  {
+    ++hashed_calls;
+    if(x.hash() != serial::detail::hash_key(key(x))) ++mismatched_hashes;
+    return has(key(x));
+  }
+
+  bool        as_bool(const serial::hashed_key& x) const{ return as_bool(key(x)); }
+  int         as_int(const serial::hashed_key& x) const{ return as_int(key(x)); }
+  float       as_float(const serial::hashed_key& x) const{ return as_float(key(x)); }
+  std::string as_string(const serial::hashed_key& x) const{ return as_string(key(x)); }
+
+  template<typename Func>
+  void as_bool_sequence(const serial::hashed_key& x, Func func) const{ as_bool_sequence(key(x), func); }
+
+  template<typename Func>
+  void as_int_sequence(const serial::hashed_key& x, Func func) const{ as_int_sequence(key(x), func); }
+
+  template<typename Func>
+  void as_float_sequence(const serial::hashed_key& x, Func func) const{ as_float_sequence(key(x), func); }
+
+  template<typename Func>
+  void as_string_sequence(const serial::hashed_key& x, Func func) const{ as_string_sequence(key(x), func); }
+
+private:
+  static std::string key(const serial::hashed_key& x){ return std::string(x.data(), x.size()); }
+};
+
+/// Dummy translator that lends out views of its strings
+class BorrowingDummyTranslator : public DummyTranslator
+{
+public:
+
+  serial::string_view as_string_view(const std::string&) const{ return string_value; }
+
+  template<typename Func>
+  void as_string_view_sequence(const std::string&, Func func) const
+  {
+    for(const auto& s : string_vector) {
+      func(serial::string_view(s));
+    }
+  }
+
+};
+
 #endif /* TEST_DUMMYTRANSLATOR_HPP_ */
@@ -0,0 +1,246 @@
+/**
+ * \file MonotonicArenaTests
+ *
+ * \brief Test cases for the monotonic arena and arena allocator
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#include "catch.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <DataTranslator.hpp>
+#include <MonotonicArena.hpp>
+
+#include "DummyTranslator.hpp"
+
+namespace {
+
+  typedef std::basic_string<char,std::char_traits<char>,serial::arena_allocator<char>> ArenaString;
+
+  struct ArenaExampleClass
+  {
+    bool        bool_scalar;
+    int         int_scalar;
+    float       float_scalar;
+    ArenaString string_scalar;
+
+    std::vector<bool,serial::arena_allocator<bool>>               bool_vector;
+    std::vector<int,serial::arena_allocator<int>>                 int_vector;
+    std::vector<float,serial::arena_allocator<float>>             float_vector;
+    std::vector<ArenaString,serial::arena_allocator<ArenaString>> string_vector;
+  };
+
+  typedef serial::DataTranslator<ArenaExampleClass,bool,int,float,ArenaString,std::string,serial::arena_allocator> ArenaTranslator;
+
+  struct CompactExampleClass
+  {
+    int                  int_scalar;
+    serial::arena_string string_scalar;
+
+    std::vector<serial::arena_string,serial::arena_allocator<serial::arena_string>> string_vector;
+  };
+
+  typedef serial::DataTranslator<CompactExampleClass,bool,int,float,serial::arena_string,std::string,serial::arena_allocator> CompactTranslator;
+
+  // Dummy translator that produces strings as character pointers, which
+  // are converted into arena strings
+  class ArenaDummyTranslator : public DummyTranslator
+  {
+  public:
+    const char* as_string(const std::string&) const{ return string_value.c_str(); }
+
+    template<typename Func>
+    void as_string_sequence(const std::string&, Func func) const
+    {
+      for(const auto& s : string_vector) {
+        func(s.c_str());
+      }
+    }
+  };
+
+  // Dummy sequence of 3 identical entries
+  class ArenaDummySequenceTranslator : public ArenaDummyTranslator
+  {
+  public:
+    bool next(){ return ++m_index < 3; }
+  private:
+    int m_index = 0;
+  };
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Arena
+//----------------------------------------------------------------------------
+
+TEST_CASE("monotonic_arena") {
+
+  serial::monotonic_arena arena(256);
+
+  SECTION("Allocations are aligned") {
+    arena.allocate(1, 1);
+    const auto* p = arena.allocate(8, 8);
+
+    REQUIRE( reinterpret_cast<std::uintptr_t>(p) % 8 == 0 );
+    REQUIRE( arena.allocated() == 9 );
+  }
+
+  SECTION("Allocations larger than a block are satisfied") {
+    auto* p = static_cast<char*>(arena.allocate(1000, 16));
+    std::fill(p, p + 1000, 'x');
+
+    REQUIRE( arena.allocated() == 1000 );
+  }
+
+  SECTION("Releasing the arena resets it") {
+    arena.allocate(100, 4);
+    arena.release();
+
+    REQUIRE( arena.allocated() == 0 );
+  }
+
+  SECTION("Huge page backed arenas allocate") {
+    serial::monotonic_arena huge_arena(4096, true);
+    auto* p = static_cast<int*>(huge_arena.allocate(sizeof(int) * 16, alignof(int)));
+    std::fill(p, p + 16, 42);
+
+    REQUIRE( p[15] == 42 );
+  }
+}
+
+TEST_CASE("arena_scope") {
+
+  serial::monotonic_arena outer;
+  serial::monotonic_arena inner;
+
+  REQUIRE( serial::monotonic_arena::current() == nullptr );
+  {
+    serial::arena_scope outer_scope(outer);
+    REQUIRE( serial::monotonic_arena::current() == &outer );
+    {
+      serial::arena_scope inner_scope(inner);
+      REQUIRE( serial::monotonic_arena::current() == &inner );
+      REQUIRE( serial::arena_allocator<int>().arena() == &inner );
+    }
+    REQUIRE( serial::monotonic_arena::current() == &outer );
+  }
+  REQUIRE( serial::monotonic_arena::current() == nullptr );
+  REQUIRE( serial::arena_allocator<int>().arena() == nullptr );
+}
+
+TEST_CASE("arena_string") {
+
+  serial::monotonic_arena arena;
+
+  SECTION("Arena strings are copied into the current arena") {
+    serial::arena_scope scope(arena);
+
+    const std::string source = "enabled";
+    const serial::arena_string copy = source;
+
+    REQUIRE( sizeof(serial::arena_string) == sizeof(const char*) + sizeof(std::size_t) );
+    REQUIRE( std::string(copy) == source );
+    REQUIRE( copy.c_str()[copy.size()] == '\0' );
+    REQUIRE( copy.data() != source.data() );
+    REQUIRE( arena.allocated() == source.size() + 1 );
+  }
+
+  SECTION("Empty arena strings do not allocate") {
+    const serial::arena_string empty;
+    const serial::arena_string copy( arena, std::string() );
+
+    REQUIRE( empty == copy );
+    REQUIRE( copy.c_str()[0] == '\0' );
+    REQUIRE( arena.allocated() == 0 );
+  }
+
+  SECTION("Arena strings require an arena") {
+    REQUIRE_THROWS_AS( serial::arena_string( std::string("enabled") ), const std::logic_error& );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Translation
+//----------------------------------------------------------------------------
+
+TEST_CASE("arena translate") {
+
+  const ArenaTranslator translator = ArenaTranslator()
+    .add_member("scalar.int", &ArenaExampleClass::int_scalar)
+    .add_member("scalar.string", &ArenaExampleClass::string_scalar)
+    .add_member("vector.int", &ArenaExampleClass::int_vector)
+    .add_member("vector.string", &ArenaExampleClass::string_vector)
+    .freeze();
+
+  serial::monotonic_arena arena;
+
+  SECTION("Members of objects constructed in scope allocate from the arena") {
+    serial::arena_scope scope(arena);
+
+    ArenaExampleClass example;
+    const auto count = translator.translate(&example, ArenaDummyTranslator());
+
+    REQUIRE( count == 4 );
+    REQUIRE( example.int_vector.get_allocator().arena() == &arena );
+    REQUIRE( std::equal(example.int_vector.begin(), example.int_vector.end(), DummyTranslator::int_vector.begin()) );
+    REQUIRE( example.string_scalar == DummyTranslator::string_value.c_str() );
+    REQUIRE( example.string_vector.size() == DummyTranslator::string_vector.size() );
+    REQUIRE( arena.allocated() >= sizeof(int) * DummyTranslator::int_vector.size() );
+  }
+
+  SECTION("translate_sequence allocates every entry from the arena") {
+    std::vector<ArenaExampleClass> examples;
+    {
+      serial::arena_scope scope(arena);
+
+      ArenaDummySequenceTranslator data;
+      translator.translate_sequence(std::back_inserter(examples), data);
+    }
+
+    REQUIRE( examples.size() == 3 );
+    for( const auto& example : examples ) {
+      REQUIRE( example.int_vector.get_allocator().arena() == &arena );
+      REQUIRE( example.string_vector.get_allocator().arena() == &arena );
+    }
+
+    examples.clear();
+    arena.release();
+    REQUIRE( arena.allocated() == 0 );
+  }
+}
+
+TEST_CASE("arena batch translate") {
+
+  const CompactTranslator translator = CompactTranslator()
+    .add_member("scalar.int", &CompactExampleClass::int_scalar)
+    .add_member("scalar.string", &CompactExampleClass::string_scalar)
+    .add_member("vector.string", &CompactExampleClass::string_vector)
+    .freeze();
+
+  serial::monotonic_arena arena;
+
+  std::vector<CompactExampleClass> examples;
+  ArenaDummySequenceTranslator data;
+  translator.translate_sequence(std::back_inserter(examples), data, arena);
+
+  REQUIRE( serial::monotonic_arena::current() == nullptr );
+  REQUIRE( examples.size() == 3 );
+
+  // Every string payload and vector of the batch is appended to the arena
+  const auto string_bytes = (DummyTranslator::string_value.size() + 1) + 5 * 2;
+  const auto vector_bytes = 5 * sizeof(serial::arena_string);
+  REQUIRE( arena.allocated() == 3 * (string_bytes + vector_bytes) );
+
+  for( const auto& example : examples ) {
+    REQUIRE( std::string(example.string_scalar) == DummyTranslator::string_value );
+    REQUIRE( example.string_vector.size() == DummyTranslator::string_vector.size() );
+    REQUIRE( std::string(example.string_vector.back()) == DummyTranslator::string_vector.back() );
+  }
+
+  examples.clear();
+  arena.release();
+}
@@ -0,0 +1,208 @@
+/**
+ * \file StaticDataTranslatorTests.cpp
+ *
+ * \brief Test cases for the static data translator
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#include "catch.hpp"
+
+#include <StaticDataTranslator.hpp>
+
+#include "DummyTranslator.hpp"
+
+namespace {
+
+  struct StaticExampleClass
+  {
+    bool        bool_scalar;
+    int         int_scalar;
+    float       float_scalar;
+    std::string string_scalar;
+
+    std::vector<int>         int_vector;
+    std::vector<std::string> string_vector;
+  };
+
+  SERIAL_STATIC_KEY(bool_key,          "scalar.bool");
+  SERIAL_STATIC_KEY(int_key,           "scalar.int");
+  SERIAL_STATIC_KEY(float_key,         "scalar.float");
+  SERIAL_STATIC_KEY(string_key,        "scalar.string");
+  SERIAL_STATIC_KEY(int_vector_key,    "vector.int");
+  SERIAL_STATIC_KEY(string_vector_key, "vector.string");
+
+  typedef serial::StaticDataTranslator<
+    StaticExampleClass,
+    SERIAL_STATIC_MEMBER(bool_key,          &StaticExampleClass::bool_scalar),
+    SERIAL_STATIC_MEMBER(int_key,           &StaticExampleClass::int_scalar),
+    SERIAL_STATIC_MEMBER(float_key,         &StaticExampleClass::float_scalar),
+    SERIAL_STATIC_MEMBER(string_key,        &StaticExampleClass::string_scalar),
+    SERIAL_STATIC_MEMBER(int_vector_key,    &StaticExampleClass::int_vector),
+    SERIAL_STATIC_MEMBER(string_vector_key, &StaticExampleClass::string_vector)
+  > StaticExampleTranslator;
+
+  constexpr StaticExampleTranslator static_translator{};
+
+  // Dummy sequence of 3 identical entries
+  class DummySequenceTranslator : public DummyTranslator
+  {
+  public:
+    bool next(){ return ++m_index < 3; }
+  private:
+    int m_index = 0;
+  };
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Capacity
+//----------------------------------------------------------------------------
+
+TEST_CASE("static members") {
+  static_assert(StaticExampleTranslator::members() == 6, "members() is usable in constant expressions");
+
+  SECTION("Empty StaticDataTranslator has no members")
+  {
+    REQUIRE( serial::StaticDataTranslator<StaticExampleClass>::members() == 0 );
+  }
+
+  SECTION("StaticDataTranslator has members")
+  {
+    REQUIRE( static_translator.members() == 6 );
+  }
+}
+
+// Member kinds are deduced from the member type
+static_assert(SERIAL_STATIC_MEMBER(bool_key, &StaticExampleClass::bool_scalar)::kind == serial::member_kind::bool_scalar, "bool members deduce bool_scalar");
+static_assert(SERIAL_STATIC_MEMBER(int_key, &StaticExampleClass::int_scalar)::kind == serial::member_kind::int_scalar, "integral members deduce int_scalar");
+static_assert(SERIAL_STATIC_MEMBER(float_key, &StaticExampleClass::float_scalar)::kind == serial::member_kind::float_scalar, "floating point members deduce float_scalar");
+static_assert(SERIAL_STATIC_MEMBER(string_key, &StaticExampleClass::string_scalar)::kind == serial::member_kind::string_scalar, "other members deduce string_scalar");
+static_assert(SERIAL_STATIC_MEMBER(int_vector_key, &StaticExampleClass::int_vector)::kind == serial::member_kind::int_vector, "integral vectors deduce int_vector");
+static_assert(SERIAL_STATIC_MEMBER(string_vector_key, &StaticExampleClass::string_vector)::kind == serial::member_kind::string_vector, "other vectors deduce string_vector");
+
+//----------------------------------------------------------------------------
+// Loaders
+//----------------------------------------------------------------------------
+
+TEST_CASE("static translate") {
+
+  StaticExampleClass example;
+
+  const auto count = static_translator.translate(&example, DummyTranslator());
+
+  SECTION("translate translates every member") {
+    REQUIRE( count == 6 );
+  }
+
+  SECTION("translate translates scalar entries correctly") {
+    REQUIRE( example.bool_scalar == DummyTranslator::bool_value );
+    REQUIRE( example.int_scalar == DummyTranslator::int_value );
+    REQUIRE( example.string_scalar == DummyTranslator::string_value );
+  }
+
+  SECTION("translate translates vector entries correctly") {
+    REQUIRE( example.int_vector == DummyTranslator::int_vector );
+    REQUIRE( example.string_vector == DummyTranslator::string_vector );
+  }
+}
+
+TEST_CASE("static translate_sequence") {
+
+  std::vector<StaticExampleClass> examples;
+  DummySequenceTranslator data;
+
+  const auto count = static_translator.translate_sequence(std::back_inserter(examples), data);
+
+  SECTION("translate_sequence translates every entry") {
+    REQUIRE( examples.size() == 3 );
+    REQUIRE( count == 18 );
+  }
+
+  SECTION("translate_sequence translates entries correctly") {
+    for( auto const& example : examples ) {
+      REQUIRE( example.int_scalar == DummyTranslator::int_value );
+      REQUIRE( example.string_vector == DummyTranslator::string_vector );
+    }
+  }
+}
+
+TEST_CASE("static translate_sequence_into") {
+
+  std::vector<StaticExampleClass> examples(4);
+  examples[1].int_vector.assign(64, -1);
+  examples[1].string_scalar = "stale";
+
+  DummySequenceTranslator data;
+  const auto count = static_translator.translate_sequence_into(examples, data);
+
+  REQUIRE( count == 18 );
+  REQUIRE( examples.size() == 3 );
+  REQUIRE( examples[1].int_vector == DummyTranslator::int_vector );
+  REQUIRE( examples[1].int_vector.capacity() >= 64 );
+  REQUIRE( examples[1].string_scalar == DummyTranslator::string_value );
+}
+
+TEST_CASE("static prepare") {
+
+  typedef serial::StaticDataTranslator<
+    StaticExampleClass,
+    SERIAL_STATIC_MEMBER(int_key, &StaticExampleClass::int_scalar)
+  > PreparedTranslator;
+
+  PreparingDummyTranslator::prepare_calls = 0;
+  PreparingDummyTranslator::handle_calls  = 0;
+
+  StaticExampleClass example;
+  PreparedTranslator().translate(&example, PreparingDummyTranslator());
+  PreparedTranslator().translate(&example, PreparingDummyTranslator());
+
+  // Keys are prepared once for each scheme type, and the prepared keys are
+  // passed to the scheme on every translation
+  REQUIRE( PreparingDummyTranslator::prepare_calls == 1 );
+  REQUIRE( PreparingDummyTranslator::handle_calls == 2 );
+  REQUIRE( example.int_scalar == DummyTranslator::int_value );
+}
+
+TEST_CASE("static hashed keys") {
+
+  typedef serial::StaticDataTranslator<
+    StaticExampleClass,
+    SERIAL_STATIC_MEMBER(int_key, &StaticExampleClass::int_scalar),
+    SERIAL_STATIC_MEMBER(int_vector_key, &StaticExampleClass::int_vector)
+  > HashedTranslator;
+
+  HashingDummyTranslator::hashed_calls      = 0;
+  HashingDummyTranslator::mismatched_hashes = 0;
+
+  StaticExampleClass example;
+  const auto count = HashedTranslator().translate(&example, HashingDummyTranslator());
+
+  // Static keys are passed with the hash computed at compile time
+  REQUIRE( count == 2 );
+  REQUIRE( HashingDummyTranslator::hashed_calls == 2 );
+  REQUIRE( HashingDummyTranslator::mismatched_hashes == 0 );
+  REQUIRE( example.int_scalar == DummyTranslator::int_value );
+}
+
+TEST_CASE("static borrowed strings") {
+
+  struct StaticBorrowingClass
+  {
+    serial::string_view              string_view_scalar;
+    std::vector<serial::string_view> string_view_vector;
+  };
+
+  typedef serial::StaticDataTranslator<
+    StaticBorrowingClass,
+    SERIAL_STATIC_MEMBER(string_key, &StaticBorrowingClass::string_view_scalar),
+    SERIAL_STATIC_MEMBER(string_vector_key, &StaticBorrowingClass::string_view_vector)
+  > BorrowingTranslator;
+
+  StaticBorrowingClass example;
+  const auto count = BorrowingTranslator().translate(&example, BorrowingDummyTranslator());
+
+  REQUIRE( count == 2 );
+  REQUIRE( example.string_view_scalar.data() == DummyTranslator::string_value.data() );
+  REQUIRE( example.string_view_vector.size() == DummyTranslator::string_vector.size() );
+  REQUIRE( example.string_view_vector.front().data() == DummyTranslator::string_vector.front().data() );
+}
@@ -0,0 +1,139 @@
+/**
+ * \file StringPoolTests.cpp
+ *
+ * \brief Test cases for the string pool and interned strings
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#include "catch.hpp"
+
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+#include <DataTranslator.hpp>
+#include <StringPool.hpp>
+
+#include "DummyTranslator.hpp"
+
+namespace {
+
+  struct InternedExampleClass
+  {
+    int                                  int_scalar;
+    serial::interned_string              string_scalar;
+    std::vector<serial::interned_string> string_vector;
+  };
+
+  typedef serial::DataTranslator<InternedExampleClass,bool,int,float,serial::interned_string> InternedTranslator;
+
+  // Dummy sequence of 3 identical entries
+  class InternedDummySequenceTranslator : public DummyTranslator
+  {
+  public:
+    bool next(){ return ++m_index < 3; }
+  private:
+    int m_index = 0;
+  };
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// String Pool
+//----------------------------------------------------------------------------
+
+TEST_CASE("string_pool") {
+
+  serial::string_pool pool;
+
+  SECTION("Equal strings are interned once") {
+    const auto& first  = pool.intern(std::string("enabled"));
+    const auto& second = pool.intern("enabled");
+    const auto& third  = pool.intern(serial::string_view("disabled"));
+
+    REQUIRE( &first == &second );
+    REQUIRE( &first != &third );
+    REQUIRE( first == "enabled" );
+    REQUIRE( pool.size() == 2 );
+
+    pool.clear();
+    REQUIRE( pool.size() == 0 );
+  }
+
+  SECTION("Concurrent interning shares one copy") {
+    std::vector<const std::string*> results(8);
+    std::vector<std::thread> threads;
+
+    for( std::size_t i = 0; i < results.size(); ++i ) {
+      threads.emplace_back([&pool,&results,i]()
+      {
+        for( int j = 0; j < 1000; ++j ) {
+          pool.intern(std::to_string(j));
+        }
+        results[i] = &pool.intern(std::string("US"));
+      });
+    }
+    for( auto& t : threads ) t.join();
+
+    REQUIRE( pool.size() == 1001 );
+    for( const auto* result : results ) {
+      REQUIRE( result == results.front() );
+    }
+  }
+}
+
+TEST_CASE("interned_string") {
+
+  serial::string_pool pool;
+  serial::intern_scope scope(pool);
+
+  SECTION("Interned strings intern into the current pool") {
+    const serial::interned_string a = std::string("US");
+    const serial::interned_string b = "US";
+
+    REQUIRE( a == b );
+    REQUIRE( a.data() == b.data() );
+    REQUIRE( a == std::string("US") );
+    REQUIRE( pool.size() == 1 );
+  }
+
+  SECTION("Empty interned strings are not interned") {
+    const serial::interned_string a;
+
+    REQUIRE( a.empty() );
+    REQUIRE( a == std::string() );
+    REQUIRE( pool.size() == 0 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Translation
+//----------------------------------------------------------------------------
+
+TEST_CASE("interned translate") {
+
+  serial::string_pool pool;
+  serial::intern_scope scope(pool);
+
+  InternedTranslator translator = InternedTranslator()
+    .add_member("scalar.int", &InternedExampleClass::int_scalar)
+    .add_member("scalar.string", &InternedExampleClass::string_scalar)
+    .add_member("vector.string", &InternedExampleClass::string_vector)
+    .freeze();
+
+  InternedDummySequenceTranslator data;
+  std::vector<InternedExampleClass> objects;
+  translator.translate_sequence(std::back_inserter(objects), data);
+
+  REQUIRE( objects.size() == 3 );
+
+  // "hello world" and the letters of "hello"
+  REQUIRE( pool.size() == 5 );
+
+  for( const auto& object : objects ) {
+    REQUIRE( object.string_scalar == DummyTranslator::string_value );
+    REQUIRE( object.string_scalar.data() == objects.front().string_scalar.data() );
+    REQUIRE( object.string_vector.size() == DummyTranslator::string_vector.size() );
+    REQUIRE( object.string_vector[2].data() == object.string_vector[3].data() );
+  }
+}